@@ -32,6 +32,13 @@ By default, Justina sets the size of specific memory areas taking into account t
   ...and functions defined in a Justina program is set to 255 (which is the absolute maximum).
 - On SAMD boards, which have less RAM memory, program memory size is set to 4000. Maximum number of user variables is set to 64, ...
   ...program variable NAMES: 64, static variables: 32, user functions: 32.
+- The evaluation stack (intermediate results of expressions being evaluated, including those of callers of the Justina function being executed) is preallocated 
+  with a fixed capacity: 500 levels on ESP32, RP2040 and nRF52840 boards, 100 levels on SAMD boards.
+- Local variable storage of called Justina functions (frame stack) is preallocated as well: 4096 bytes on ESP32, RP2040 and nRF52840 boards, 1024 bytes on SAMD boards.
+- Up to 8 (SAMD boards: 4) parsed eval() strings are kept for reuse, so that evaluating the same string again does not parse it again.
+- Strings stored in variables can be up to 1023 characters long on ESP32, RP2040 and nRF52840 boards, 255 characters on SAMD boards (longer strings are clipped).
+- Identical string literals in a Justina program share one stored copy. The number of distinct literals that can be shared is one per 128 bytes of program memory
+  (PROGMEM_SIZE minus 500 bytes for immediate mode commands), with a maximum of 255: 230 with the default program memory size on ESP32, RP2040 and nRF52840 boards. Literals beyond that limit are still stored, but they are no longer shared.
 
 Depending on your specific requirements, these sizes can be increased or decreased. For instance, if you use quite big arrays, consuming a lot of memory,...
 ...it could be useful to decrease the program memory size.
@@ -56,4 +63,54 @@ To change allocated memory sizes WITHOUT CHANGING ANY OF THE FILES IN THE JUSTIN
 #define MAXVAR_STAT 100         // max. distinct static variables allowed. Absolute limit: 255
 #define MAXFUNC 50              // max. Justina functions allowed. Absolute limit: 255
 
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_NRF52840)
+#define MAXSTRLEN 1023          // max. length of strings stored in variables (longer strings are clipped), excluding terminating '\0'. Minimum: 255
+#else
+#define MAXSTRLEN 255           // boards with little RAM: keep string variables short
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_NRF52840)
+#define EVAL_STACK_SIZE 500     // max. evaluation stack levels, preallocated at startup (24 bytes each). Set to 0 to create stack levels on the heap, one by one (no fixed limit)
+#else
+#define EVAL_STACK_SIZE 100     // deeply nested expressions and recursive function calls need more levels. Exceeding the limit produces execution error 3700
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_NRF52840)
+#define FRAME_STACK_SIZE 4096   // local variable storage of open Justina functions, in bytes, preallocated at startup (9 bytes per local variable). Set to 0 to use the heap
+#else
+#define FRAME_STACK_SIZE 1024   // deeply recursive function calls need more storage. Exceeding the limit produces execution error 3701
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_NRF52840)
+#define EVAL_CACHE_SIZE 8       // parsed eval() strings kept for reuse (the least recently used one is replaced). Set to 0 to parse each eval() string again
+#else
+#define EVAL_CACHE_SIZE 4
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_NRF52840)
+#define BATCH_LINE_CACHE_SIZE 4096  // parsed batch file lines kept for reuse while a batch file is open, in bytes (all open batch files). Set to 0 to read and parse each line again
+#else
+#define BATCH_LINE_CACHE_SIZE 0     // boards with little RAM: no batch line cache
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_NRF52840)
+#define PROFILE_STATEMENTS 256  // profiler: max. distinct program statements with counters, preallocated at startup (12 bytes each). Set to 0 to leave out the profiler
+#else
+#define PROFILE_STATEMENTS 64   // statements executed beyond this limit are counted per function only
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_NRF52840)
+#define TRACE_EVENTS 512        // tracer: ring buffer capacity, in events, preallocated at startup (8 bytes each). Set to 0 to leave out the tracer
+#else
+#define TRACE_EVENTS 0          // boards with little RAM: no tracer
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_NRF52840)
+#define STRING_BUFFER_SIZE 16384    // string buffers (bufPrint commands): max. characters per buffer, allocated as the buffer fills. Exceeding the limit produces execution error 3209
+#else
+#define STRING_BUFFER_SIZE 2048
+#endif
+
+#define CLOCK_SAMPLE_MAX_CALLS 256  // housekeeping: max. calls (one per statement executed) between two clock readings, adapted to read the clock about every 10 ms. Set to 1 to read the clock at every call
+
 #endif
\ No newline at end of file
@@ -59,6 +59,30 @@
 #if !defined(MAXFUNC)
 #define MAXFUNC 255             // max. Justina functions allowed. Absolute limit: 255
 #endif
+#if !defined(MAXSTRLEN)
+#define MAXSTRLEN 1023          // max. length of strings stored in variables, excluding terminating '\0'. Minimum: 255
+#endif
+#if !defined(EVAL_STACK_SIZE)
+#define EVAL_STACK_SIZE 500     // evaluation stack: max. levels, preallocated (24 bytes each). 0: no fixed capacity (stack levels are created on the heap one by one)
+#endif
+#if !defined(FRAME_STACK_SIZE)
+#define FRAME_STACK_SIZE 4096   // local variable storage of called Justina functions, preallocated (9 bytes per local variable). 0: local storage created on the heap for each call
+#endif
+#if !defined(EVAL_CACHE_SIZE)
+#define EVAL_CACHE_SIZE 8       // parsed eval() strings kept for reuse (least recently used entry is replaced). 0: every eval() string is parsed again
+#endif
+#if !defined(BATCH_LINE_CACHE_SIZE)
+#define BATCH_LINE_CACHE_SIZE 4096  // parsed batch file lines kept for reuse while a batch file is open, in bytes (all open batch files). 0: every batch file line is read and parsed again
+#endif
+#if !defined(PROFILE_STATEMENTS)
+#define PROFILE_STATEMENTS 256  // profiler: max. distinct program statements with counters (preallocated, 12 bytes each). 0: no profiler
+#endif
+#if !defined(TRACE_EVENTS)
+#define TRACE_EVENTS 512        // tracer: ring buffer capacity, in events (preallocated, 8 bytes each). 0: no tracer
+#endif
+#if !defined(STRING_BUFFER_SIZE)
+#define STRING_BUFFER_SIZE 16384    // max. characters stored in one string buffer (memory is allocated as the buffer fills)
+#endif
 
 #else
 
@@ -76,8 +100,36 @@
 #endif
 #if !defined(MAXFUNC)
 #define MAXFUNC 32
+#endif
+#if !defined(MAXSTRLEN)
+#define MAXSTRLEN 255
+#endif
+#if !defined(EVAL_STACK_SIZE)
+#define EVAL_STACK_SIZE 100
+#endif
+#if !defined(FRAME_STACK_SIZE)
+#define FRAME_STACK_SIZE 1024
+#endif
+#if !defined(EVAL_CACHE_SIZE)
+#define EVAL_CACHE_SIZE 4
+#endif
+#if !defined(BATCH_LINE_CACHE_SIZE)
+#define BATCH_LINE_CACHE_SIZE 0
+#endif
+#if !defined(PROFILE_STATEMENTS)
+#define PROFILE_STATEMENTS 64
+#endif
+#if !defined(TRACE_EVENTS)
+#define TRACE_EVENTS 0
+#endif
+#if !defined(STRING_BUFFER_SIZE)
+#define STRING_BUFFER_SIZE 2048
+#endif
+
 #endif
 
+#if !defined(CLOCK_SAMPLE_MAX_CALLS)
+#define CLOCK_SAMPLE_MAX_CALLS 256  // housekeeping: max. calls between two clock readings (adapted to read the clock about every 10 ms). 1: read the clock at every call
 #endif
 
 // max. user variables allowed. Absolute limit: 255
@@ -107,6 +159,7 @@ private:
     // --------------------
 
     static constexpr int listNameSize = 9;                              // including terminating '\0'
+    static constexpr int maxSizeClasses = 4;                            // size class pool lists: maximum number of size classes
 
 
     // ------------------
@@ -119,6 +172,11 @@ private:
         ListElemHead* pPrev;                                            // pointer to previous list element (currently not used; needed if deleting other list elements than last) 
     };
 
+    union PoolBlockHead {                                               // size class pool lists only: precedes the list element header
+        int sizeClass;                                                  // size class index (-1: payload larger than largest size class: block is not recycled)
+        void* alignment;                                                // keep list element header aligned on a pointer boundary
+    };
+
 
     // -----------------
     // *   variables   *
@@ -137,6 +195,20 @@ private:
     char _listName[listNameSize] = "";                                  // includes terminating '\0'
     int _listID{ 0 };                                                   // list ID (in order of creation) 
 
+    // fixed capacity lists only: list elements occupy slots in one contiguous, preallocated slot area (no heap allocation per list element)
+    char* _pSlotArea = nullptr;                                         // start of slot area (nullptr: list elements are created on the heap)
+    ListElemHead* _pFreeSlot = nullptr;                                 // first free slot; free slots are chained using their 'pNext' pointer
+    int _slotCount{ 0 };                                                // list capacity (slots)
+    int _slotSize{ 0 };                                                 // slot size in bytes, including list element header
+
+    // size class pool lists only: deleted list elements are not returned to the heap but kept in a free list per size class, for recycling
+    int _sizeClassCount{ 0 };                                           // number of size classes (0: no size class pool)
+    int _sizeClassPayloadSize[maxSizeClasses]{};                        // maximum payload size per size class (ascending)
+    ListElemHead* _pFreeBlock[maxSizeClasses]{};                        // first free block per size class; free blocks are chained using their 'pNext' pointer
+
+    long _highWaterMark{ 0 };                                           // highest list element count since list creation
+    long _poolMissCount{ 0 };                                           // size class pool lists: number of list elements that could not be recycled (created on the heap)
+
 
     // ------------------------------------
     // *   methods (doc: see .cpp file)   *
@@ -157,6 +229,12 @@ private:
     void setListName(char* listName);
     char* getListName();
     void setDebugOutStream(Print** pDebugOutStream);
+    void setFixedCapacity(int slotCount, int maxPayloadSize);
+    bool isFull();
+    void setSizeClassPool(const int* pPayloadSizes, int sizeClassCount);
+    void releasePool();
+    long getHighWaterMark();
+    long getPoolMissCount();
 
     static long getCreatedObjectCount();
 };
@@ -296,7 +374,18 @@ private:
         cmdcod_setConsole,
         cmdcod_setConsIn,
         cmdcod_setConsOut,
-        cmdcod_setDebugOut
+        cmdcod_setDebugOut,
+        cmdcod_profileOn,
+        cmdcod_profileOff,
+        cmdcod_printProfile,
+        cmdcod_traceOn,
+        cmdcod_traceOff,
+        cmdcod_traceDump,
+        cmdcod_printToBuf,
+        cmdcod_printLineToBuf,
+        cmdcod_printListToBuf,
+        cmdcod_flushBuf,
+        cmdcod_clearBuf
     };
 
     // unique identification code of an internal cpp function (= built into Justina)
@@ -453,7 +542,18 @@ private:
         fnccod_exists,
         fnccod_mkdir,
         fnccod_rmdir,
-        fnccod_remove
+        fnccod_remove,
+        fnccod_bufString,
+        fnccod_bufLength,
+        fnccod_arraySum,
+        fnccod_arrayMin,
+        fnccod_arrayMax,
+        fnccod_arrayMean,
+        fnccod_arrayStdDev,
+        fnccod_arrayFill,
+        fnccod_arrayCopy,
+        fnccod_arrayScale,
+        fnccod_arrayDot
     };
 
     // unique identification code of operators and other terminals
@@ -505,7 +605,9 @@ private:
         termcod_semicolon_BPallowed,                                    // breakpoint can be set because next statement is first statement in next source code line
         termcod_semicolon_BPset,                                        // breakpoint is set
         termcod_leftPar,
-        termcod_rightPar
+        termcod_rightPar,
+        termcod_comma_lazyArg,                                          // argument separator of a lazy function (ifte, switch, choose): stored by the parser, never looked up
+        termcod_foldedConstEnd                                          // follows a folded constant: jump to the end of the original tokens (stored by the parser, never looked up)
     };
 
     enum symbConst_group_code {
@@ -673,6 +775,17 @@ private:
         tok_isEvalEnd,                                                  // execution only, signals end of parsed eval() statements and of condition strings
     };
 
+    enum tokenKind_type {                                               // pre-decoded token kind (see token decode table)
+        tokKind_notTerminal,
+        tokKind_operator,
+        tokKind_semicolon,                                              // including semicolons with breakpoint set / allowed
+        tokKind_comma,
+        tokKind_leftPar,
+        tokKind_rightPar,
+        tokKind_otherTerminal,
+        tokKind_foldedConstEnd                                          // folded constant end marker (see foldConstantExpression())
+    };
+
 
     // reading text file: current state
     enum textState { defaultState, lineStart, withinString, stringEscCharRead, afterFirstCommentSlash };
@@ -871,6 +984,7 @@ public:
         result_underflow,
         result_divByZero,
         result_testexpr_numberExpected,
+        result_stringBufferFull,                                        // string buffer: appending would exceed its max. length (STRING_BUFFER_SIZE)
 
         // breakpoint errors
         result_BP_sourcelineNumberExpected = 3300,
@@ -923,6 +1037,14 @@ public:
         result_IO_onlyAllowedInBatchFile,
         result_IO_batchFileLabelNotFound,
 
+        // execution stacks
+        result_evalStackFull = 3700,                                    // evaluation stack: all preallocated levels are in use (expression too complex or function calls nested too deeply)
+        result_frameStackFull,                                          // local variable storage (frame stack) full: Justina function calls nested too deeply
+
+        // profiler and tracer
+        result_profilerNotAvailable = 3800,                             // profiler left out (PROFILE_STATEMENTS is zero)
+        result_tracerNotAvailable,                                      // tracer left out (TRACE_EVENTS is zero)
+
         // end of valid exec error range (tested upon return of user cpp functions containing an error code)
         result_endOfExecErrorRange = 4999,
 
@@ -973,18 +1095,38 @@ private:
     static constexpr int MAX_STATIC_VARIABLES{ MAXVAR_STAT };                   // max. static variables allowed across all parsed functions (only). Absolute limit: 255
     static constexpr int MAX_LOCAL_VARIABLES{ 255 };                            // max. local variables allowed across all parsed functions, including function parameters. Absolute limit: 255
     static constexpr int MAX_JUSTINA_FUNCTIONS{ MAXFUNC };                      // max. Justina functions allowed. Absolute limit: 255
+    static constexpr int USERVAR_HASH_TABLE_SIZE{ 2 * MAX_USERVARNAMES + 1 };   // identifier name hash indexes: at least half of the hash table entries remain empty
+    static constexpr int PROGVAR_HASH_TABLE_SIZE{ 2 * MAX_PROGVARNAMES + 1 };
+    static constexpr int FUNC_HASH_TABLE_SIZE{ 2 * MAX_JUSTINA_FUNCTIONS + 1 };
+    static constexpr int IDENT_NAME_ARENA_MIN_SIZE{ 128 };                      // initial size of an identifier name arena, in bytes (a full arena doubles in size)
+    static constexpr int STRING_CONST_POOL_CHUNK{ 512 };                        // program string constant pool grows in chunks of (at least) this size, in bytes
+    static constexpr int MAX_INDEXED_STRING_CONSTS{ (_PROGRAM_MEMORY_SIZE / 128 < 255) ? _PROGRAM_MEMORY_SIZE / 128 : 255 };  // string constant pool hash index: max. strings (further strings are pooled, but not shared)
+    static constexpr int STRING_CONST_HASH_TABLE_SIZE{ 2 * MAX_INDEXED_STRING_CONSTS + 1 };  // at least half of the hash table entries remain empty
+    static constexpr int MAX_FOLD_STACK_LEVELS{ 12 };                           // constant folding (parser): max. pending operands and operators in one expression (longer expressions are not folded)
+    static constexpr int MAX_PENDING_JUMPS{ 12 };                               // short-circuit evaluation (parser): max. unresolved jump tokens in one statement (others are not resolved)
     static constexpr int MAX_LOC_VARS_IN_FUNC{ 32 };                            // max. local and parameter variables allowed (only) in an INDIVIDUAL parsed function. Absolute limit: 255 
     static constexpr int MAX_ARRAY_DIMS{ 3 };                                   // max. array dimensions allowed. Absolute limit: 3 
     static constexpr int MAX_ARRAY_ELEM{ 1000 };                                // max. elements allowed in an array. Absolute limit: 2^15-1 = 32767. Individual dimensions are limited to a size of 255
     static constexpr int MAX_LAST_RESULT_DEPTH{ 10 };                           // max. depth of 'last results' FiFo
+    static constexpr int MAX_EVAL_STACK_LEVELS{ EVAL_STACK_SIZE };              // max. evaluation stack levels (preallocated). 0: no fixed capacity (stack levels are created on the heap)
+    static constexpr int MAX_FRAME_STACK_SIZE{ FRAME_STACK_SIZE };              // bytes available for local variable storage of open Justina functions (preallocated). 0: created on the heap
+    static constexpr int MAX_EVAL_CACHE_ENTRIES{ EVAL_CACHE_SIZE };             // max. parsed eval() strings kept for reuse. 0: no eval() cache
+    static constexpr int MAX_BATCH_LINE_CACHE_SIZE{ BATCH_LINE_CACHE_SIZE };    // bytes available for parsed batch file lines kept for reuse (all open batch files). 0: no batch line cache
+    static constexpr int MAX_PROFILE_STATEMENTS{ PROFILE_STATEMENTS };          // max. distinct program statements with profiler counters (preallocated). 0: no profiler
+    static constexpr int MAX_TRACE_EVENTS{ TRACE_EVENTS };                      // tracer ring buffer capacity, in events (preallocated). 0: no tracer
 
     static constexpr int MAX_IDENT_NAME_LEN{ 30 };                              // max length of identifier names, excluding terminating '\0'
-    static constexpr int MAX_ALPHA_CONST_LEN{ 255 };                            // max length of character strings stored in variables, excluding terminating '\0',. Absolute limit: 255
+    static constexpr int MAX_ALPHA_CONST_LEN{ (MAXSTRLEN < 255) ? 255 : MAXSTRLEN };  // max length of character strings stored in variables, excluding terminating '\0'. Minimum: 255
+    static constexpr int MAX_BATCH_LABEL_LEN{ 63 };                             // max. length of a batch file label ('gotoLabel' command), excluding ending colons and terminating '\0'
     static constexpr int MAX_USER_INPUT_LEN{ 100 };                             // max. length of text a user can enter with an INPUT statement. Absolute limit: 255
     static constexpr int MAX_STATEMENT_LEN{ 500 };                              // max. length of a single user statement 
 
     static constexpr int MAX_OPEN_SD_FILES{ 5 };                                // SD card: max. concurrent open files
 
+    static constexpr int MAX_STRING_BUFFERS{ 4 };                               // string buffers (numbered 1 to MAX_STRING_BUFFERS)
+    static constexpr int MIN_STRING_BUFFER_CAPACITY{ 32 };                      // characters allocated when a string buffer is first used (capacity is doubled when full)
+    static constexpr int MAX_STRING_BUFFER_LEN{ STRING_BUFFER_SIZE };           // max. characters stored in one string buffer, excluding terminating '\0'
+
     static constexpr long LONG_WAIT_FOR_CHAR_TIMEOUT{ 10000 };                  // milliseconds
     static constexpr long DEFAULT_READ_TIMEOUT{ 500 };                          // milliseconds
 
@@ -1004,7 +1146,7 @@ private:
     static inline const int MAX_PRINT_WIDTH = 255;                      // max. width of print field. Absolute limit: 255. Width as in c++ printf 'format.width' sub-specifier
     static inline const int MAX_INT_PRECISION = 10;                     // max. integer precision (2**31: 10 digits). Precision as defined as in c++ printf 'format.precision' sub-specifier for integers
     static inline const int MAX_FLOAT_PRECISION = 8;                    // max. floating-point precision. Precision as defined as in c++ printf 'format.precision' sub-specifier for floating-point numbers
-    static inline const int MAX_STRCHAR_TO_PRINT = 255;                 // max. # of alphanumeric characters to print. Absolute limit: 255. Defined as in c++ printf 'format.precision' sub-specifier
+    static inline const int MAX_STRCHAR_TO_PRINT = MAX_ALPHA_CONST_LEN; // max. # of alphanumeric characters to print (a complete string stored in a variable). Defined as in c++ printf 'format.precision' sub-specifier
 
     static inline const char DEFAULT_FLOAT_SPECIFIER[2]{ "f" };         // default specifier for floating point numbers. Arduino doesn't recognize uppercase "F"
     static inline const char DEFAULT_INT_SPECIFIER[2]{ "d" };           // default specifier for integers 
@@ -1296,6 +1438,8 @@ private:
     // system callbacks: time interval
     // -------------------------------
     static constexpr unsigned long CALLBACK_INTERVAL = 100;             // in ms; should be considerably less than any heartbeat period defined in main program
+    static constexpr unsigned long CLOCK_SAMPLE_INTERVAL = 10;          // in ms; housekeeping calls between clock readings are adapted to read the clock at about this interval
+    static constexpr long MAX_CALLS_PER_CLOCK_SAMPLE{ CLOCK_SAMPLE_MAX_CALLS };     // limits the delay of callbacks (and stop, abort, kill requests) if statements suddenly take longer
 
 
     // user callback procedures
@@ -1421,6 +1565,12 @@ private:
         char tokenTypeAndIndex;                                         // will be set to specific token type (operator, left parenthesis, ...), AND bits 7 to 4 are set to token index
     };
 
+    // NOTE: tokenTypeAndIndex member identical to Token_terminal struct 
+    struct Token_terminalWithJump {                                     // '&&' and '||' operators, argument separators of lazy functions (ifte, switch, choose), folded constant end markers: length 3
+        char tokenTypeAndIndex;
+        char jumpOffset[2];                                             // steps to the token following the operand or argument that can be skipped (uint16_t); 0 if not resolved
+    };
+
 
     union TokenPointer {                                                // UNION of pointers to variables of all defined value types (long, float, char*)
         char* pTokenChars;
@@ -1506,9 +1656,9 @@ private:
     static constexpr CmdBlockDef cmdBlockNone{ block_none, block_na, block_na, block_na };                                      // not a 'block' command. NOTE: defined in JustinaMain.cpp
 
     // sizes MUST be specified AND must be exact
-    static const internCmdDef _internCommands[84];                                                                              // keyword names
-    static const InternCppFuncDef _internCppFunctions[142];                                                                     // internal cpp function names and codes with min & max arguments allowed
-    static const TerminalDef _terminals[40];                                                                                    // terminals (including operators)
+    static const internCmdDef _internCommands[95];                                                                              // keyword names
+    static const InternCppFuncDef _internCppFunctions[153];                                                                     // internal cpp function names and codes with min & max arguments allowed
+    static const TerminalDef _terminals[42];                                                                                    // terminals (including operators)
 #if (defined ARDUINO_ARCH_ESP32) 
     static const SymbNumConsts _symbNumConsts[83];                                                                              // predefined constants
 #else
@@ -1519,6 +1669,23 @@ private:
     static constexpr int _termTokenCount{ sizeof(_terminals) / sizeof(_terminals[0]) };                                         // count of operators and other terminals in terminals table
     static constexpr int _symbvalueCount{ sizeof(_symbNumConsts) / sizeof(_symbNumConsts[0]) };
 
+    // parser lookup indexes (built once by the constructor): command and function names in alphabetical order (binary search)...
+    // ...and terminals chained per first character (in the same order as the sequential search: from the end of the terminals table) 
+    uint8_t _internCommandSortIndex[_internCommandCount];
+    uint8_t _internCppFunctionSortIndex[_internCppFunctionCount];
+    int8_t _terminalFirstCharIndex[0x80 - ' '];                         // for each printable ASCII character: highest terminal index with that first character (-1: none)
+    int8_t _terminalNextIndex[_termTokenCount];                         // next (lower) terminal index with the same first character (-1: none)
+
+    // token decode table (built once by the constructor): token kind, token length and terminal index are fully determined by the first token byte...
+    // ...(token type in bits 3..0, token length or terminal index in bits 7..4). Entry per first token byte: b15..12 token kind, b11..8 token length, b5..0 terminal index  
+    uint16_t _tokenDecodeTable[256];
+
+    // operator precedence functions (built once by the constructor): priority and associativity of an operator on the evaluation stack, folded into one value...
+    // ...to be compared with the priority of the pending (next) terminal token: the operator on the stack is executed first if its value is greater 
+    uint8_t _prefixOpStackPriority[_termTokenCount];                    // prefix operators: 2 * prefix priority (right-to-left associativity)
+    uint8_t _infixOpStackPriority[_termTokenCount];                     // infix operators: 2 * infix priority, + 1 if left-to-right associativity
+    uint8_t _pendingTokenPriority[_termTokenCount];                     // pending terminal token: 2 * postfix priority (postfix operators) or 2 * infix priority
+
 
     // ------------------------------
     // *   unions, structures (2)   *
@@ -1563,6 +1730,7 @@ private:
 
     struct JustinaFunctionData {
         char* pJustinaFunctionStartToken;                               // Justina function: pointer to start of parsed function (token)
+        char* pFunctionBodyStartToken;                                  // semicolon ending the function definition statement, where execution starts (set when program parsing is complete)
 
         char paramOnlyCountInFunction;
         char localVarCountInFunction;                                   // needed to reserve run time storage for local variables 
@@ -1572,9 +1740,40 @@ private:
         char callsAsPartOfExpression : 1;                               // set if at least one call to this function/procedure is part of an expression (which is not allowed for a Justina procedure (no return value))
         char spare : 6;                                                 // boundary alignment
 
-        char localVarNameRefs_startIndex;                               // not in function, but overall, needed when in debugging mode only
+        char localVarNameRefs_startIndex;                               // not in function, but overall, needed when in debugging mode and to locate the local variable init data
         char staticVarStartIndex;                                       // needed when in debugging mode only
         char paramIsArrayPattern[2];                                    // parameter pattern: b15 flag set when parsing function definition or first function call; b14-b0 flags set when corresponding parameter or argument is array      
+        char minMaxArgCounts;                                           // max (bits 7654) & min (bits 3210) allowed number OR actual number of arguments
+    };
+
+    struct EvalCacheEntry {                                             // parsed eval() string, kept for reuse
+        char* pEvalString;                                              // eval() string (nullptr: entry not in use)
+        char* pParsedStatements;                                        // copy of the parsed statements, including the terminating 'no token' (string constants: owned by the entry)
+        int parsedLength;                                               // length of the parsed statements, excluding the terminating 'no token'
+        unsigned long lastUsed;                                         // eval() cache use count when entry was last used (least recently used entry is replaced)
+    };
+
+    struct ParsedExpressionsHeader {                                    // parsed watch or BP condition expressions, kept for reuse: header, followed by one ParsedExpressionHeader + parsed statements per expression
+        int blockSize;                                                  // bytes, including this header
+        int functionIndex;                                              // stopped (or breakpoint) function: parsed local and static variable references depend on it
+        uint32_t paramArrayDims;                                        // array dimension count of each parameter of that function (2 bits per parameter, 0: scalar)
+    };
+
+    struct ParsedExpressionHeader {                                     // one parsed watch or condition expression (not necessarily aligned: copy memory)
+        int parsingResult;                                              // parsing result (if error: no parsed statements follow)
+        int tokenBytes;                                                 // length of the parsed statements, including the terminating 'no token'
+    };
+
+    struct IdentNameArena {                                             // packed identifier name storage: each name is stored as a length byte, the name and a terminating '\0'
+        char* pArea;                                                    // start of arena (nullptr if no names stored)
+        int size;                                                       // arena size, in bytes
+        int used;                                                       // bytes in use
+    };
+
+    struct StringConstPoolChunk {                                       // program string constant pool chunk, followed by the strings: 2 length bytes (not aligned: copy memory), string, terminating '\0'
+        StringConstPoolChunk* pNextChunk;                               // chunks are never moved or resized (parsed program statements point to the strings)
+        int size;                                                       // bytes available for strings
+        int used;                                                       // bytes in use
     };
 
 
@@ -1597,6 +1796,40 @@ private:
         char bytes[4];
     };
 
+    struct LocalVarInitData {                                           // precalculated initialization of a local variable (parameter with default value or non-parameter local variable)
+        Val initValue;                                                  // long, float or pointer to parsed string constant (nullptr if empty string)
+        int arrayElements;                                              // arrays only: number of array elements
+        char valueType;                                                 // value type and 'is array' flag
+        char arrayDimsAndCount[4];                                      // arrays only: char 0 to 2 is dimensions; char 3 = dimension count (as stored in array element 0)
+    };
+
+
+    // constant folding (parser): operand and operator stack entries while evaluating the constant parts of a parsed expression
+    // -----------------------------------------------------------------------------------------------------------------------
+
+    struct FoldOperand {
+        Val value;
+        char valueType;                                                 // value_isLong or value_isFloat if a numeric constant; 0 if not (variable, function result, ...)
+        bool isOperationResult;                                         // constant is the result of one or more operations (a token range that can be folded)
+        uint16_t startStep;                                             // token range in program memory: first token
+        uint16_t endStep;                                               // token range in program memory: first token following the range
+    };
+
+    struct FoldOperator {
+        char terminalIndex;
+        bool isPrefix;
+        uint16_t step;                                                  // operator token step in program memory
+    };
+
+    // short-circuit evaluation (parser): jump token waiting for the token ending the operand or argument it can skip
+    // -------------------------------------------------------------------------------------------------------------
+
+    struct PendingJump {
+        uint16_t step;                                                  // jump token step in program memory
+        uint8_t parenthesisLevel;
+        uint8_t stackPriority;                                          // '&&', '||': infix operator stack priority (see precedence functions); argument separator: 0
+    };
+
 
     //  evaluation stack data (execution)
     // ----------------------------------
@@ -1756,6 +1989,63 @@ private:
         OpenFile() : fileNumberInUse(0), isSystemFile(0), lineEndsInMultiLineComment(0), silent(0) {}
     };
 
+    struct BatchLabelIndex {                                            // labels of a batch file, with the file position of the line following each label
+        char* filePath{ nullptr };                                      // batch file path (nullptr: entry not in use)
+        uint32_t fileSize{ 0 };                                         // file size when the index was built: index is built again if the batch file size changed
+        char* pLabels{ nullptr };                                       // per label: file position (4 bytes, not aligned: copy memory), label, terminating '\0' (nullptr if no labels)
+        int labelsSize{ 0 };                                            // bytes in use
+        unsigned long lastUsed{ 0 };                                    // label index use count when entry was last used (least recently used entry is replaced)
+    };
+
+    struct BatchLineCache {                                             // parsed lines of an open batch file, kept for reuse while the batch file stays open
+        char* pLines{ nullptr };                                        // per line: BatchLineHeader (not aligned: copy memory), parsed statements, terminating 'no token'
+        int linesSize{ 0 };                                             // bytes in use
+        int linesCapacity{ 0 };                                         // bytes allocated
+        int nextLookup{ 0 };                                            // offset of the line following the line last found or stored: look-up starts here
+    };
+
+    struct BatchLineHeader {
+        uint32_t lineStart;                                             // file position of the first character of the line (key)
+        uint32_t lineEnd;                                               // file position following the new line character ending the line
+        bool withinMultiLineCommentAtStart;                             // multi-line comment state at line start (part of the key) and at line end
+        bool withinMultiLineCommentAtEnd;
+        int tokenBytes;                                                 // parsed statements, including terminating 'no token'
+    };
+
+    struct ProfileFunctionCounters {                                    // profiler: counters per Justina function (indexed by function index)
+        long calls;
+        long statements;                                                // statements started in the function (not including called functions)
+        unsigned long micros;                                           // time spent in the function (not including called functions)
+    };
+
+    struct ProfileStatementCounters {                                   // profiler: counters per parsed statement (hash table entry)
+        char* pStatement;                                               // first token of the statement in program memory (key; nullptr: entry not in use)
+        long count;
+        unsigned long micros;
+    };
+
+    enum traceEvent_type {                                              // tracer: events are recorded in pairs (begin and end)
+        trace_function,                                                 // Justina function call
+        trace_eval,                                                     // eval() string execution
+        trace_batchFile,                                                // batch file execution
+        trace_SDfile,                                                   // SD file open until closed
+        trace_callback                                                  // housekeeping callback
+    };
+
+    struct TraceEvent {                                                 // tracer: ring buffer entry
+        unsigned long time;                                             // micros()
+        char eventType;                                                 // trace event type
+        char phase;                                                     // 'B' (begin) or 'E' (end)
+        uint16_t id;                                                    // Justina function index, batch file or SD file number
+    };
+
+    struct StringBuffer {                                               // string buffer: characters are appended in place (bufPrint commands)
+        char* pChars{ nullptr };                                        // nullptr if no memory allocated (empty buffer)
+        int length{ 0 };                                                // characters in use, excluding terminating '\0'
+        int capacity{ 0 };                                              // characters allocated, excluding terminating '\0'
+        int printColumn{ 0 };                                           // print column, used by tab() and col() functions
+    };
+
 
     // external cpp (user callback) functions: a structure for each return type (bool, char, int, long, float, char*, void)
     // --------------------------------------------------------------------------------------------------------------------
@@ -1943,6 +2233,8 @@ private:
     // -----------------------------------------------------------------------
 
     uint16_t _lastTokenStep, _lastVariableTokenStep;
+    uint16_t _statementStartStep;                                   // step of the first token of the statement being parsed (constant folding)
+    bool _statementHasJumpTokens{ false };                          // statement being parsed contains jump tokens ('&&', '||', lazy function argument separators)
     uint16_t _blockCmdTokenStep, _blockStartCmdTokenStep;           // remember step number (in JUSTINA program memory) of keyword starting a block command                           
 
     tokenType_type _lastTokenType{ tok_no_token };                  // type of last token parsed
@@ -2016,6 +2308,7 @@ private:
     int _openDebugLevels{ 0 };                                              // number of stopped programs: equals parsed command line stack depth minus open eval() strings (= eval() strings being executed)
 
     char _semicolonBPallowed_token{}, _semicolonBPset_token{};              // will be initialized when Justina starts up
+    char _commaLazyArg_token{}, _foldedConstEnd_token{};                    // idem
 
 
     // console settings and output and print commands
@@ -2076,6 +2369,7 @@ private:
     int _stepCmdExecuted{ db_continue };                                    // type of debugging command executed (step, ...)
     bool _debugCmdExecuted{ false };                                        // a debug command was executed
     bool _appFlagStopRequestIsStored{ false };                              // remember app flag request to stop for debug, until it can be honored                                
+    bool _debugMachineryArmed{ false };                                     // step or debug command executed, stop request stored or breakpoints set: check for stops at statement boundaries
     bool _holdStopForDebugWhileConditionEval{ false };                      // remember to stop anyway if condition string result (not yet calculated) is zero
 
     Breakpoints* _pBreakpoints{ nullptr };
@@ -2129,6 +2423,19 @@ private:
     // local variable storage areas
     int _localVarValueAreaCount = 0, _localVarValueAreaErrors = 0;                      // storage areas for local variables and attributes                      
 
+    // frame stack: local variable storage of all open Justina functions, carved out of one preallocated area (if MAX_FRAME_STACK_SIZE is not zero)
+    Val* _pFrameStackArea{ nullptr };                                                   // Val array: aligned for all local variable storage areas
+    int _frameStackTop{ 0 };                                                            // bytes in use
+
+    // eval() cache: parsed eval() strings, kept for reuse (if MAX_EVAL_CACHE_ENTRIES is not zero)
+    // the cache is cleared when the machine is reset and when user variables are created or deleted (because parsed statements refer to variables by index) 
+    EvalCacheEntry* _pEvalCache{ nullptr };                                             // eval() cache entries (preallocated, empty)
+    unsigned long _evalCacheUseCount{ 0 };                                              // number of eval() cache look-ups, used as 'time' for least recently used entry
+    long _evalCacheHits{ 0 }, _evalCacheMisses{ 0 };                                    // since cold start
+
+    // watch string parsed at a previous stop (breakpoint watch and condition strings: kept in breakpoint table) 
+    char* _pParsedWatchString{ nullptr };                                               // nullptr if not parsed yet or invalidated
+
 
     // system (main) callback
     // ----------------------
@@ -2137,6 +2444,34 @@ private:
 
     long _appFlags = 0x00L;                                                             // bidirectional flags to transfer info / requests between main program and Justina library
     unsigned long _lastCallBackTime{ 0 }, _currenttime{ 0 }, _previousTime{ 0 };
+    long _callsPerClockSample{ 1 };                                                     // housekeeping: calls between clock readings (adaptive)
+    long _callsToClockSample{ 1 };                                                      // housekeeping: calls remaining until next clock reading
+
+    // worst-case stop latency: time between the callback preceding the callback relaying a stop, abort or kill request and the moment execution honours it
+    bool _stopRequestPending{ false };                                                  // request relayed by the housekeeping callback, not yet honoured
+    unsigned long _stopRequestWindowStart{ 0 };                                         // time of the callback preceding the one relaying the request
+    unsigned long _maxStopLatency{ 0 };                                                 // in ms, since cold start
+
+
+    // profiler: counters per Justina function and per parsed statement (tables preallocated)
+    // --------------------------------------------------------------------------------------
+
+    ProfileFunctionCounters* _pProfileFunctions{ nullptr };                             // nullptr if no profiler
+    ProfileStatementCounters* _pProfileStatements{ nullptr };                           // hash table, keyed by statement address
+    bool _profilingOn{ false };
+    int _profileFunctionIndex{ -1 };                                                    // function being profiled (-1: none)
+    int _profileStatementSlot{ -1 };                                                    // statement being profiled (-1: none, or not recorded)
+    unsigned long _profileLastTime{ 0 };                                                // micros() when counters were last updated
+    long _profileStatementsNotRecorded{ 0 };                                            // statements started while the statement table was full
+
+
+    // tracer: events in a ring buffer (preallocated); when full, the oldest events are overwritten
+    // ---------------------------------------------------------------------------------------------
+
+    TraceEvent* _pTraceEvents{ nullptr };                                               // nullptr if no tracer
+    bool _tracingOn{ false };
+    int _traceNextEvent{ 0 };                                                           // ring buffer entry to write next
+    int _traceEventCount{ 0 };                                                          // events in ring buffer
 
 
     // RTC callback: storage for function address
@@ -2188,7 +2523,13 @@ private:
 #endif
 
     OpenFile openFiles[MAX_OPEN_SD_FILES];                          // open files: file paths and attributed file numbers
+    StringBuffer _stringBuffers[MAX_STRING_BUFFERS];                // string buffers: kept until a machine reset including user variables
     int _openFileCount = 0;
+    BatchLabelIndex _batchLabelIndexes[MAX_OPEN_SD_FILES];          // 'gotoLabel' command: label index of batch files (kept when a batch file is closed)
+    unsigned long _batchLabelIndexUseCount{ 0 };                    // used as 'time' for least recently used label index
+    BatchLineCache _batchLineCaches[MAX_OPEN_SD_FILES];             // parsed batch file lines (deleted when a batch file is closed)
+    int _batchLineCacheSize{ 0 };                                   // bytes allocated, all open batch files (limited to MAX_BATCH_LINE_CACHE_SIZE)
+    long _batchLineCacheHits{ 0 }, _batchLineCacheMisses{ 0 };      // since cold start
     int _SDcardChipSelectPin{ 10 };
     bool _SDinitOK = false;
 
@@ -2242,6 +2583,21 @@ private:
     // function key data storage
     char* JustinaFunctionNames[MAX_JUSTINA_FUNCTIONS];
     JustinaFunctionData justinaFunctionData[MAX_JUSTINA_FUNCTIONS];
+    LocalVarInitData* _pLocalVarInitData{ nullptr };                // init data of all local variables of all Justina functions (indexed as localVarNameRef)
+
+    // identifier name hash indexes (open addressing, linear probing): each entry contains an identifier name index + 1 (0: empty entry)
+    uint8_t userVarNameHashIndex[USERVAR_HASH_TABLE_SIZE]{ 0 };
+    uint8_t programVarNameHashIndex[PROGVAR_HASH_TABLE_SIZE]{ 0 };
+    uint8_t JustinaFunctionNameHashIndex[FUNC_HASH_TABLE_SIZE]{ 0 };
+
+    // identifier name arenas: program variable and Justina function names (append only) and user variable names (compacted when a user variable is deleted)
+    IdentNameArena _programNameArena{ nullptr, 0, 0 };
+    IdentNameArena _userVarNameArena{ nullptr, 0, 0 };
+
+    // string constant pool: string literals in parsed program statements (each distinct string is stored once)
+    StringConstPoolChunk* _pStringConstPool{ nullptr };             // chunk in use (earlier chunks are linked to it)
+    char** _pStringConstHashIndex{ nullptr };                       // hash index (open addressing, linear probing): pointers to pooled strings (nullptr: empty entry)
+    int _indexedStringConstCount{ 0 };                              // strings in the hash index
 
     // local variable value storage
     char localVarNameRef[MAX_LOCAL_VARIABLES]{ 0 };                 // used while in DEBUGGING mode only: index of local variable NAME
@@ -2376,6 +2732,11 @@ private:
     void deleteStringArrayVarsStringObjects(Val* varValues, char* varType, int varNameCount, int paramOnlyCount, bool checkIfGlobalValue, bool isUserVar = false, bool isLocalVar = false);
     void deleteVariableValueObjects(Val* varValues, char* varType, int varNameCount, int paramOnlyCount, bool checkIfGlobalValue, bool isUserVar = false, bool isLocalVar = false);
     void deleteConstStringObjects(char* pToken);
+    void copyConstStringObjects(char* pToken);
+    void clearEvalCache();
+    void deleteEvalCacheEntry(EvalCacheEntry& entry);
+    void deleteParsedExpressions(char*& pParsedExpressions);
+    void deleteAllParsedDebugExpressions();
     void deleteOneArrayVarStringObjects(Val* varValues, int index, bool isUserVar, bool isLocalVar);
     void deleteLastValueFiFoStringObjects();
 
@@ -2396,6 +2757,13 @@ private:
 
     // parse one statement from source statement input buffer
     parsingResult_type parseStatement(char*& pInputLine, char*& pNextParseStatement, int& clearIndicator, bool& isSilentOnOffStatement);
+    void buildParserLookupIndexes();
+    void buildTokenDecodeTable();
+    char* foldedConstantEnd(char* pToken);
+    void buildOperatorPrecedenceTables();
+    int findInternCommand(char* pch, int nameLength);
+    int findInternCppFunction(char* pch, int nameLength);
+    int findTerminal(char* pch);
     bool parseAsInternCommand(char*& pNext, parsingResult_type& result);
     bool parseAsExternCommand(char*& pNext, parsingResult_type& result);
     bool parseAsNumber(char*& pNext, parsingResult_type& result);
@@ -2407,6 +2775,14 @@ private:
     bool parseAsVariable(char*& pNext, parsingResult_type& result);
     bool parseAsIdentifierName(char*& pNext, parsingResult_type& result);
 
+    // constant folding of parsed expressions
+    void foldConstantExpression(int parenthesisLevel);
+    bool foldUnaryOperation(int terminalIndex, Val& operand, char& valueType);
+    bool foldInfixOperation(int terminalIndex, Val& operand1, char& valueType1, Val operand2, char valueType2);
+
+    // short-circuit evaluation: jump offsets of '&&', '||' and lazy function argument separators
+    void resolveJumpOffsets();
+
     // checking command statement syntax
     bool checkCommandKeyword(parsingResult_type& result, int commandIndex, bool commandIsInternal, bool& isSilentKeyword);
     bool checkCommandArgToken(parsingResult_type& result, int& clearIndicatore, int commandIndex, bool commandIsInternal);
@@ -2419,6 +2795,8 @@ private:
     bool checkJustinaFuncArgArrayPattern(parsingResult_type& result, bool isFunctionClosingParenthesis);
     bool checkAllJustinaFunctionsDefined(int& index);
     bool resetFunctionFlags();
+    void buildLocalVarInitData();
+    void deleteLocalVarInitData();
 
     // basic parsing routines for constants, without other syntax checks etc. 
     bool parseIntFloat(char*& pNext, char*& pch, Val& value, char& valueType, int& predefinedConstIndex, parsingResult_type& result);
@@ -2426,6 +2804,18 @@ private:
 
     // find an identifier (Justina variable or Justina function), init a Justina variable
     int getIdentifier(char** pIdentArray, int& identifiersInUse, int maxIdentifiers, char* pIdentNameToCheck, int identLength, bool& createNew, bool isUserVar = false);
+    uint32_t identNameHash(const char* pIdentName, int identLength);
+    uint8_t* getIdentHashIndex(char** pIdentArray, int& hashTableSize);
+    void rebuildIdentHashIndex(char** pIdentArray, int identifiersInUse);
+    char* storeIdentName(char* pIdentName, int identLength, bool isUserVar);
+    void removeUserVarName(int index);
+    void resetIdentNameArena(IdentNameArena& arena);
+    uint32_t stringLiteralHash(const char* pLiteral, int length);
+    char* findPooledStringConst(const char* pLiteral, int length, uint32_t hash);
+    char* stringConstPoolSpace(int length);
+    void addToStringConstPool(char* pString, int length, uint32_t hash);
+    bool isPooledStringConst(char* pString);
+    void deleteStringConstPool();
     bool initVariable(uint16_t varTokenStep, uint16_t constTokenStep);
 
     // process parsed input and start execution
@@ -2443,22 +2833,32 @@ private:
     execResult_type  execAllProcessedOperators();
     execResult_type  execUnaryOperation(bool isPrefix);
     execResult_type  execInfixOperation();
+    bool execNumericInfixOperation(execResult_type& execResult);
     void makeIntermediateConstant(LE_evalStack* pEvalStackLvl);
+    bool skipRightOperand(int terminalIndex);
+    execResult_type  execLazyArgSeparator();
+    bool lazyArgIsTrue(LE_evalStack* pStackLvl, bool& isNumber);
+    bool lazyArgMatches(LE_evalStack* pStackLvl1, LE_evalStack* pStackLvl2);
     execResult_type  execInternalCppFunction(LE_evalStack*& pPrecedingStackLvl, LE_evalStack*& pLeftParStackLvl, int argCount, bool& forcedAbortRequest);
     execResult_type  execExternalCppFncOrCmd(LE_evalStack*& pFunctionStackLvl, LE_evalStack*& pFirstArgStackLvl, int maxArgs, bool isCommand = false);
     execResult_type  launchJustinaFunction(LE_evalStack*& pFunctionStackLvl, LE_evalStack*& pFirstArgStackLvl, int suppliedArgCount);
     execResult_type  launchEval(LE_evalStack*& pFunctionStackLvl, char* parsingInput);
+    bool getEvalCacheEntry(char* parsingInput);
+    void storeEvalCacheEntry(char* parsingInput);
     execResult_type  launchBatchFileExecution(int cmdArgCount, LE_evalStack*& pStackLvl);
-    void terminateJustinaFunction(bool isVoidFunction, bool addZeroReturnValue = false);
+    execResult_type terminateJustinaFunction(bool isVoidFunction, bool addZeroReturnValue = false);
+    int localVarStorageSize(int localVarCount);
+    void createLocalVarStorage(int localVarCount);
+    void releaseLocalVarStorage();
     void terminateEval();
     void terminateBatchFile();
 
     // Justina functions: initialize parameter variables with provided arguments (pass by reference)
     void initFunctionParamVarWithSuppliedArg(int suppliedArgCount, LE_evalStack*& pFirstArgStackLvl);
     // Justina functions: initialize parameter variables with default values
-    void initFunctionDefaultParamVariables(char*& calledFunctionTokenStep, int suppliedArgCount, int paramCount);
+    void initFunctionDefaultParamVariables(int suppliedArgCount, int paramCount);
     // Justina functions: initialize other local variables 
-    void initFunctionLocalNonParamVariables(char* calledFunctionTokenStep, int paramCount, int localVarCount);
+    void initFunctionLocalNonParamVariables(int paramCount, int localVarCount);
 
     // when the 'end' keyword of a for..end loop is encountered, test the control variable value against the final loop value 
     execResult_type testForLoopCondition(bool& fail);
@@ -2470,13 +2870,13 @@ private:
     void saveLastValue(bool& overWritePrevious);
 
     // push a token to the evaluation stack
-    void pushTerminalToken(int tokenType);
-    void pushInternCppFunctionName(int tokenType);
-    void pushExternCppFunctionName(int tokenType);
-    void pushJustinaFunctionName(int tokenType);
-    void pushGenericName(int tokenType);
-    void pushConstant(int tokenType);
-    void pushVariable(int tokenType);
+    execResult_type pushTerminalToken(int tokenType);
+    execResult_type pushInternCppFunctionName(int tokenType);
+    execResult_type pushExternCppFunctionName(int tokenType);
+    execResult_type pushJustinaFunctionName(int tokenType);
+    execResult_type pushGenericName(int tokenType);
+    execResult_type pushConstant(int tokenType);
+    execResult_type pushVariable(int tokenType);
 
     // copy function arguments with attributes from the evaluation stack to value and attribute arrays, for use by internal and external (user callback) functions
     void copyValueArgsFromStack(LE_evalStack*& pStackLvl, int argCount, bool* argIsVar, bool* argIsArray, char* valueType, Val* args, bool passVarRefOrConst = false, Val* dummyArgs = nullptr);
@@ -2487,6 +2887,7 @@ private:
     // replace array variable base address and subscripts with the array element address on the evaluation stack
     Justina::execResult_type arrayAndSubscriptsToarrayElement(LE_evalStack*& pPrecedingStackLvl, LE_evalStack*& pLeftParStackLvl, int argCount);
     void* arrayElemAddress(void* varBaseAddress, int* dims);        // fetch the address of an array element
+    int arrayElementCount(void* pArray);                            // total number of array elements (all dimensions)
 
     // clear execution stacks
     void clearEvalStack();
@@ -2496,6 +2897,7 @@ private:
 
     execResult_type deleteVarStringObject(LE_evalStack* pStackLvl);
     execResult_type deleteIntermStringObject(LE_evalStack* pStackLvl);
+    char* takeIntermStringObject(LE_evalStack* pStackLvl);
 
 
     // streams, SD card and files
@@ -2513,6 +2915,18 @@ private:
     void SD_closeFile(int fileNumber);
     execResult_type SD_listFiles();
 
+    BatchLabelIndex* getBatchLabelIndex(int fileNumber, bool& kill, bool& forcedAbortRequest);
+    bool buildBatchLabelIndex(int fileNumber, BatchLabelIndex& labelIndex, bool& kill, bool& forcedAbortRequest);
+    void addBatchLabel(BatchLabelIndex& labelIndex, int& labelsCapacity, const char* label, uint32_t position);
+    bool findBatchLabel(BatchLabelIndex& labelIndex, const char* label, uint32_t& position);
+    void deleteBatchLabelIndex(const char* filePath);
+    void deleteBatchLabelIndexes();
+
+    bool getBatchLineCacheEntry(int fileNumber, uint32_t lineStart);
+    void storeBatchLineCacheEntry(int fileNumber, uint32_t lineStart, bool withinMultiLineCommentAtStart);
+    void deleteBatchLineCache(int fileNumber);
+    void clearBatchLineCaches();
+
     execResult_type returnStreamRef(long argIsLongBits, long argIsFloatBits, Val arg, long argIndex, Stream*& pStream, int& streamNumber, bool forOutput = false,
         int allowedFileTypes = 1, bool allowSystemFiles = 0);
     execResult_type returnStreamRef(int streamNumber, Stream*& pStream, bool forOutput = false, int allowedFileTypes = 1, bool allowSystemFiles = 0);
@@ -2536,9 +2950,14 @@ private:
     bool trapError(bool& isEndOfStatementSeparator, execResult_type& execResult);
     void checkConditionResult(execResult_type& execResult);
     void checkForStop(bool& isActiveBreakpoint, bool& doStopForDebugNow, bool& appFlagsRequestStop, char* programCnt_previousStatementStart);
-    void parseAndExecWatchOrBPwatchString(int BPindex = -1);
+    void updateDebugMachineryArmed();
+    void parseAndExecWatchOrBPwatchString(OpenFunctionData* pOpenFunction, int BPindex = -1);
     void printDebugInfo(execResult_type execResult);
     parsingResult_type parseConditionString(int BPindex);
+    uint32_t paramArrayDims(OpenFunctionData* pOpenFunction);
+    bool parsedExpressionsAreValid(char* pParsedExpressions, OpenFunctionData* pOpenFunction);
+    void appendParsedExpression(char*& pParsedExpressions, OpenFunctionData* pOpenFunction, parsingResult_type parsingResult);
+    char* restoreParsedExpression(char* pParsedExpression, parsingResult_type& parsingResult);
 
     // printing
     // --------    
@@ -2550,6 +2969,10 @@ private:
     void printToString(int width, int precision, bool inputIsString, bool isIntFmt, char* valueType, Val* operands, char* fmtString,
         Val& fcnResult, int& charsPrinted, bool expandStrings = false);
 
+    // string buffers
+    execResult_type appendToStringBuffer(StringBuffer* pBuffer, const char* s, int length);
+    void deleteStringBuffer(StringBuffer* pBuffer);
+
     // 'unparse' statement and pretty print, print parsing result (OK or error number), print variables, print call stack, SD card directory
     void prettyPrintStatements(int outputStream, int instructionCount, char* startToken = nullptr, char* errorProgCounter = nullptr, int* sourceErrorPos = nullptr);
     void printParsingResult(parsingResult_type result, int funcNotDefIndex, char* const pInputLine, long lineCount, char* pErrorPos);
@@ -2563,6 +2986,27 @@ private:
     // -----------------------
 
     void execPeriodicHousekeeping(bool* pKillNow, bool* pForcedAbort = nullptr, bool* pSetStdConsole = nullptr);
+    void stopRequestHonoured();
+
+
+    // profiler
+    // --------
+
+    void clearProfile();
+    void profileCharge();
+    void profileStatementStart(char* pStatement);
+    void profileFunctionEntered(char* pFirstStatement);
+    void profileReturnToCaller();
+    void profileStop();
+    int profileStatementSlot(char* pStatement, bool addIfNew);
+    void printProfile(bool asCSV);
+
+    // tracer
+    // ------
+
+    void clearTrace();
+    void traceEvent(char eventType, char phase, int id);
+    void printTrace();
 
 
     // utilities
@@ -2606,6 +3050,8 @@ private:
         char* pProgramStep{ nullptr };                  // compare with current program counter to find breakpoint entry 
         char* pWatch{ nullptr };                        // pointer to watch expressions separated by semicolons (string)
         char* pCondition{ nullptr };                    // pointer to condition expression (string)
+        char* pParsedWatch{ nullptr };                  // watch expressions, parsed at a previous breakpoint stop (nullptr if not parsed yet)
+        char* pParsedCondition{ nullptr };              // condition expression, parsed when the breakpoint was previously reached (nullptr if not parsed yet)
         long hitCount{ 0 };                             // pointer to number of hits triggering breakpoint
         long hitCounter{ 0 };                           // hit counter
 
@@ -2621,6 +3067,8 @@ private:
     char* _BPlineRangeStorage{ nullptr };               // pointer to start of array keeping track of source line ranges for debugging with breakpoints
     long _BPlineRangeStorageUsed{ 0 };
     BreakpointData* _pBreakpointData{ nullptr };
+    int _BPstepHashTableSize{ 0 };                      // at least half of the hash table entries remain empty
+    uint8_t* _pBPstepHashIndex{ nullptr };              // breakpoint table row (+1) for a parsed statement start address (0: empty entry)
 
     // methods
     Breakpoints(Justina* pJustina, long lineRanges_memorySize, long maxBreakpointCount);
@@ -2643,6 +3091,8 @@ private:
     Justina::execResult_type maintainBreakpointTable(long sourceLine, char* pProgramStep, bool doSet, bool doClear, bool doEnable, bool doDisable,
         int extraAttribCount, const char* watchString, long hitCount, const char* conditionString);
     BreakpointData* findBPtableRow(char* pParsedStatement, int& row);
+    int BPstepHash(char* pParsedStatement);
+    void rebuildBPstepHashIndex();
     Justina::execResult_type tryBPactivation();
     long findLineNumberForBPstatement(char* pProgramStepToFind);
     void  printBreakpoints();
@@ -37,6 +37,80 @@
 // *****************************************************
 
 
+// ----------------------------------------------------------------------------------------------------
+// *   build token decode table: pre-decode token kind, token length and terminal index for execution   *
+// ----------------------------------------------------------------------------------------------------
+
+// token kind, token length and (terminal tokens) terminal index only depend on the first byte of a token: decode all 256 possible first token bytes once...
+// ...so that the executor does not need to unpack the token type byte and look up the terminal code in the terminals table for every token it processes
+
+void Justina::buildTokenDecodeTable() {
+    for (int tokenByte = 0; tokenByte <= 0xFF; tokenByte++) {
+        int tokenType = tokenByte & 0x0F;
+        int tokenKind{ tokKind_notTerminal }, terminalIndex{ 0 };
+
+        // terminals and constants: token length is NOT stored in token type
+        int tokenLength = (tokenType >= tok_isTerminalGroup1) ? sizeof(Token_terminal) : (tokenType == tok_isConstant) ? sizeof(Token_constant) :
+            (tokenType == tok_isSymbolicConstant) ? sizeof(Token_symbolicConstant) : (tokenByte >> 4) & 0x0F;
+
+        bool isTerminal = ((tokenType == tok_isTerminalGroup1) || (tokenType == tok_isTerminalGroup2) || (tokenType == tok_isTerminalGroup3));
+        if (isTerminal) {
+            terminalIndex = ((tokenByte >> 4) & 0x0F) + ((tokenType == tok_isTerminalGroup2) ? 0x10 : (tokenType == tok_isTerminalGroup3) ? 0x20 : 0);
+            if (terminalIndex < _termTokenCount) {                                                  // index beyond terminals table: never occurs in parsed statements
+                int terminalCode = _terminals[terminalIndex].terminalCode;
+                tokenKind = (terminalCode <= termcod_opRangeEnd) ? tokKind_operator :
+                    ((terminalCode == termcod_semicolon) || (terminalCode == termcod_semicolon_BPset) || (terminalCode == termcod_semicolon_BPallowed)) ? tokKind_semicolon :
+                    ((terminalCode == termcod_comma) || (terminalCode == termcod_comma_lazyArg)) ? tokKind_comma : (terminalCode == termcod_leftPar) ? tokKind_leftPar :
+                    (terminalCode == termcod_rightPar) ? tokKind_rightPar : (terminalCode == termcod_foldedConstEnd) ? tokKind_foldedConstEnd : tokKind_otherTerminal;
+
+                // jump tokens: terminal token followed by a jump offset
+                if ((terminalCode == termcod_and) || (terminalCode == termcod_or) || (terminalCode == termcod_comma_lazyArg) || (terminalCode == termcod_foldedConstEnd)) {
+                    tokenLength = sizeof(Token_terminalWithJump);
+                }
+            }
+            else { tokenKind = tokKind_otherTerminal; }
+        }
+        _tokenDecodeTable[tokenByte] = (tokenKind << 12) | (tokenLength << 8) | terminalIndex;
+    }
+}
+
+
+// -----------------------------------------------------------------------------
+// *   folded constant: return the first token following its original tokens   *
+// -----------------------------------------------------------------------------
+
+// a folded constant (see foldConstantExpression()) is followed by an end marker and by the original tokens of the folded operation, kept for listing
+// returns nullptr if the token is not a folded constant
+
+char* Justina::foldedConstantEnd(char* pToken) {
+    if ((*pToken & 0x0F) != tok_isConstant) { return nullptr; }
+    char* pMarker = pToken + sizeof(Token_constant);                                                // always a next token (at least the 'no token' token)
+    if ((_tokenDecodeTable[(uint8_t)*pMarker] >> 12) != tokKind_foldedConstEnd) { return nullptr; }
+
+    uint16_t jumpOffset{};
+    memcpy(&jumpOffset, ((Token_terminalWithJump*)pMarker)->jumpOffset, sizeof(char[2]));        // not necessarily aligned with word size: copy memory instead
+    return pMarker + jumpOffset;
+}
+
+
+// ---------------------------------------------------------------
+// *   build operator precedence tables (precedence functions)   *
+// ---------------------------------------------------------------
+
+// an operator on the evaluation stack, preceding the last operand, is executed before the pending (next) terminal token is processed...
+// ...if its priority is higher than the priority of the pending token, or if priorities are equal and the operator is left-to-right associative
+// folding associativity into the stack priority (2 * priority, + 1 if left-to-right associative) and doubling the pending token priority...
+// ...reduces this test to one comparison at runtime: stack priority > pending token priority 
+
+void Justina::buildOperatorPrecedenceTables() {
+    for (int i = 0; i < _termTokenCount; i++) {
+        _prefixOpStackPriority[i] = 2 * (_terminals[i].prefix_priority & 0x1F);                            // bits b4..0 = priority; prefix operators: always right-to-left associativity
+        _infixOpStackPriority[i] = 2 * (_terminals[i].infix_priority & 0x1F) + ((_terminals[i].infix_priority & op_RtoL) ? 0 : 1);
+        _pendingTokenPriority[i] = 2 * ((_terminals[i].postfix_priority != 0) ? (_terminals[i].postfix_priority & 0x1F) : (_terminals[i].infix_priority & 0x1F));
+    }
+}
+
+
 // ---------------------------------
 // *   execute parsed statements   *
 // ---------------------------------
@@ -76,6 +150,10 @@ Justina::execResult_type Justina::exec(char* startHere) {
     // switch single step mode OFF before starting to execute command line (even in debug mode). Step and Debug commands will switch it on again (to execute one step).
     _stepCmdExecuted = db_continue;
     _debugCmdExecuted = false;                                                          // Justina function to debug must be on same command line as Debug command
+    updateDebugMachineryArmed();
+
+    _stopRequestPending = false;                                                        // only requests relayed during execution are measured (worst-case stop latency)
+    if (_profilingOn) { _profileLastTime = micros(); }                                  // time between executions is not profiled
 
     _programCounter = startHere;
     holdProgramCnt_StatementStart = programCnt_previousStatementStart = holdErrorProgramCnt_StatementStart = errorProgramCnt_previousStatement = _programCounter;
@@ -128,22 +206,21 @@ Justina::execResult_type Justina::exec(char* startHere) {
         _pDebugOut->print("** START exec 1 token step: step = "); _pDebugOut->println(_programCounter - _programStorage);
     #endif
 
-        bool isTerminal = ((tokenType == tok_isTerminalGroup1) || (tokenType == tok_isTerminalGroup2) || (tokenType == tok_isTerminalGroup3));
-        if (isTerminal) {
-            tokenIndex = ((((Token_terminal*)_programCounter)->tokenTypeAndIndex >> 4) & 0x0F);
-            tokenIndex += ((tokenType == tok_isTerminalGroup2) ? 0x10 : (tokenType == tok_isTerminalGroup3) ? 0x20 : 0);
-        }
+        // token kind, terminal index and token length are pre-decoded: one table lookup, using the first token byte 
+        uint16_t tokenDecode = _tokenDecodeTable[(uint8_t)*_programCounter];
+        int tokenKind = tokenDecode >> 12;
 
-        bool isOperator = (isTerminal ? (_terminals[tokenIndex].terminalCode <= termcod_opRangeEnd) : false);
-        bool isSemicolon = (isTerminal ? ((_terminals[tokenIndex].terminalCode == termcod_semicolon) || (_terminals[tokenIndex].terminalCode == termcod_semicolon_BPset)
-            || (_terminals[tokenIndex].terminalCode == termcod_semicolon_BPallowed)) : false);
-        bool isComma = (isTerminal ? (_terminals[tokenIndex].terminalCode == termcod_comma) : false);
-        bool isLeftPar = (isTerminal ? (_terminals[tokenIndex].terminalCode == termcod_leftPar) : false);
-        bool isRightPar = (isTerminal ? (_terminals[tokenIndex].terminalCode == termcod_rightPar) : false);
+        bool isTerminal = (tokenKind != tokKind_notTerminal);
+        if (isTerminal) { tokenIndex = tokenDecode & 0x3F; }
 
-        // fetch next token (for some token types, the size is stored in the upper 4 bits of the token type byte)
-        int tokenLength = (tokenType >= tok_isTerminalGroup1) ? sizeof(Token_terminal) : (tokenType == tok_isConstant) ? sizeof(Token_constant) :
-            (tokenType == tok_isSymbolicConstant) ? sizeof(Token_symbolicConstant) : (*_programCounter >> 4) & 0x0F;
+        bool isOperator = (tokenKind == tokKind_operator);
+        bool isSemicolon = (tokenKind == tokKind_semicolon);
+        bool isComma = (tokenKind == tokKind_comma);
+        bool isLeftPar = (tokenKind == tokKind_leftPar);
+        bool isRightPar = (tokenKind == tokKind_rightPar);
+
+        // fetch next token
+        int tokenLength = (tokenDecode >> 8) & 0x0F;
         _activeFunctionData.pNextStep = _programCounter + tokenLength;                  // look ahead
 
         lastWasEndOfStatementSeparator = isEndOfStatementSeparator;
@@ -257,7 +334,8 @@ Justina::execResult_type Justina::exec(char* startHere) {
             case tok_isInternCppFunction:
             {
 
-                pushInternCppFunctionName(tokenType);
+                execResult = pushInternCppFunctionName(tokenType);
+                if (execResult != result_exec_OK) { break; }
 
             #if PRINT_PROCESSED_TOKEN
                 _pDebugOut->print("   process "); _pDebugOut->print(tokenType == tok_isInternCppFunction ? "internal fcn" : tokenType == tok_isExternCppFunction ? "external user cpp fcn" : "Justina fcn");
@@ -277,7 +355,8 @@ Justina::execResult_type Justina::exec(char* startHere) {
             case tok_isExternCppFunction:
             {
 
-                pushExternCppFunctionName(tokenType);
+                execResult = pushExternCppFunctionName(tokenType);
+                if (execResult != result_exec_OK) { break; }
 
             #if PRINT_PROCESSED_TOKEN
                 _pDebugOut->print("   process "); _pDebugOut->print(tokenType == tok_isInternCppFunction ? "internal cpp fcn" : tokenType == tok_isExternCppFunction ? "external cpp fcn" : "Justina fcn");
@@ -299,7 +378,8 @@ Justina::execResult_type Justina::exec(char* startHere) {
             case tok_isJustinaFunction:
             {
 
-                pushJustinaFunctionName(tokenType);
+                execResult = pushJustinaFunctionName(tokenType);
+                if (execResult != result_exec_OK) { break; }
 
             #if PRINT_PROCESSED_TOKEN
                 _pDebugOut->print("   process "); _pDebugOut->print(tokenType == tok_isInternCppFunction ? "internal cpp fcn" : tokenType == tok_isExternCppFunction ? "external cpp fcn" : "Justina fcn");
@@ -318,7 +398,8 @@ Justina::execResult_type Justina::exec(char* startHere) {
 
             case tok_isGenericName:
             {
-                pushGenericName(tokenType);
+                execResult = pushGenericName(tokenType);
+                if (execResult != result_exec_OK) { break; }
 
             #if PRINT_PROCESSED_TOKEN
                 _pDebugOut->print("   process identifier: step "); _pDebugOut->print(_programCounter - _programStorage);  _pDebugOut->print(", eval stack depth "); _pDebugOut->print(evalStack.getElementCount()); _pDebugOut->print(" [");
@@ -338,7 +419,12 @@ Justina::execResult_type Justina::exec(char* startHere) {
 
                 // name index of predefined symbolic constants is not needed any more, and rest of structure is identical to literal constant structure                                                      
                 tokenType = tok_isConstant;
-                pushConstant(tokenType);
+                execResult = pushConstant(tokenType);
+                if (execResult != result_exec_OK) { break; }
+
+                // folded constant ? skip the original tokens of the folded operation (before looking at the next token to execute pending operators)
+                char* pFoldedOperationEnd = foldedConstantEnd(_programCounter);
+                if (pFoldedOperationEnd != nullptr) { _activeFunctionData.pNextStep = pFoldedOperationEnd; }
 
             #if PRINT_PROCESSED_TOKEN
                 _pDebugOut->print("   process constant  : step "); _pDebugOut->print(_programCounter - _programStorage);  _pDebugOut->print(", eval stack depth "); _pDebugOut->print(evalStack.getElementCount()); _pDebugOut->print(" [");
@@ -366,7 +452,8 @@ Justina::execResult_type Justina::exec(char* startHere) {
             case tok_isVariable:
             {
                 _activeFunctionData.errorProgramCounter = _programCounter;             // in case an error occurs while processing token
-                pushVariable(tokenType);
+                execResult = pushVariable(tokenType);
+                if (execResult != result_exec_OK) { break; }
 
             #if PRINT_PROCESSED_TOKEN
                 _pDebugOut->print("   process var name: step "); _pDebugOut->print(_programCounter - _programStorage);  _pDebugOut->print(", eval stack depth "); _pDebugOut->print(evalStack.getElementCount()); _pDebugOut->print(" [");
@@ -417,8 +504,14 @@ Justina::execResult_type Justina::exec(char* startHere) {
                 if (isOperator || isLeftPar) {
                     bool doCaseBreak{ false };
 
+                    // '&&' or '||' operator: if the left operand decides the result, skip the right operand (short-circuit evaluation)
+                    if (isOperator && ((_terminals[tokenIndex].terminalCode == termcod_and) || (_terminals[tokenIndex].terminalCode == termcod_or))) {
+                        if (skipRightOperand(tokenIndex)) { execResult = execAllProcessedOperators(); break; }
+                    }
+
                     // terminal tokens: only operators and left parentheses are pushed on the stack
-                    pushTerminalToken(tokenType);
+                    execResult = pushTerminalToken(tokenType);
+                    if (execResult != result_exec_OK) { break; }
 
                     if (precedingIsComma) { _pEvalStackTop->terminal.index |= 0x80;   doCaseBreak = true; }                             // flag that preceding token is comma separator 
 
@@ -482,6 +575,12 @@ Justina::execResult_type Justina::exec(char* startHere) {
                             (streamNumber < 0) ? _pExternPrintColumns + (-streamNumber) - 1 : &(openFiles[streamNumber - 1].currentPrintColumn);
                         setCurrentPrintColumn = false;      // reset
                     }
+
+                    // lazy function argument separator (ifte, switch, choose): skip arguments not needed to produce the function result
+                    if (_terminals[tokenIndex].terminalCode == termcod_comma_lazyArg) {
+                        execResult = execLazyArgSeparator();
+                        if (execResult != result_exec_OK) { break; }
+                    }
                 }
 
 
@@ -719,13 +818,16 @@ Justina::execResult_type Justina::exec(char* startHere) {
                 }
             }
 
+            // profiler: a new statement starts (after a function return, the statement containing the function call continues)
+            if (_profilingOn && !isFunctionReturn) { profileStatementStart(_programCounter); }
+
             // examine kill, stop and abort requests from Justina caller ('shell')
             // -------------------------------------------------------------------
 
             bool kill, forcedAbort{};
 
             execPeriodicHousekeeping(&kill, &forcedAbort);
-            if (kill) { execResult = EVENT_kill; return execResult; }                                       // kill Justina interpreter ? (buffer is now flushed until next line character)
+            if (kill) { stopRequestHonoured(); execResult = EVENT_kill; return execResult; }                // kill Justina interpreter ? (buffer is now flushed until next line character)
             appFlagsRequestAbort = appFlagsRequestAbort || forcedAbort;
 
             // process debugging commands (entered from the command line, or forced abort / stop requests received while a program is running  
@@ -739,10 +841,13 @@ Justina::execResult_type Justina::exec(char* startHere) {
 
             if (!_parsingExecutingWatchString && !_parsingExecutingConditionString && !executingEvalString && (execResult == result_exec_OK)) {
                 bool isActiveBreakpoint{ false }, doStopForDebugNow{ false };
-                checkForStop(isActiveBreakpoint, doStopForDebugNow, isFunctionReturn, programCnt_previousStatementStart);
-                tokenType = *_programCounter & 0x0F;             // adapt next token type (could be changed by a  string)
-                if (appFlagsRequestAbort) { execResult = EVENT_abort; }
-                else if (doStopForDebugNow) { execResult = (isActiveBreakpoint ? EVENT_stopForBreakpoint : EVENT_stopForDebug); }
+                // no breakpoints, step commands or stop requests: nothing to check, except after a function return (checkForStop() maintains the 'function return' flag)
+                if (_debugMachineryArmed || isFunctionReturn) {
+                    checkForStop(isActiveBreakpoint, doStopForDebugNow, isFunctionReturn, programCnt_previousStatementStart);
+                    tokenType = *_programCounter & 0x0F;         // adapt next token type (could be changed by a  string)
+                }
+                if (appFlagsRequestAbort) { execResult = EVENT_abort; stopRequestHonoured(); }
+                else if (doStopForDebugNow) { execResult = (isActiveBreakpoint ? EVENT_stopForBreakpoint : EVENT_stopForDebug); stopRequestHonoured(); }
             }
         }
 
@@ -900,6 +1005,7 @@ Justina::execResult_type Justina::exec(char* startHere) {
     _pDebugOut->println("     returning to main");
 #endif
     _activeFunctionData.pNextStep = _programStorage + _PROGRAM_MEMORY_SIZE;                                 // only to signal 'immediate mode command level'
+    if (_profilingOn) { profileStop(); }
 
     return execResult;                                                                                      // return result, in case it's needed by caller
 };
@@ -967,7 +1073,8 @@ bool Justina::trapError(bool& isEndOfStatementSeparator, execResult_type& execRe
             if (!trapErrorHere) {
             // this function is not trapping errors: terminate function (and keep looking for function in the call stack with error trapping enabled)
                 bool isVoidFunctionDef = (justinaFunctionData[_activeFunctionData.functionIndex].isVoidFunctionDef == 1);
-                terminateJustinaFunction(isVoidFunctionDef, !isVoidFunctionDef);                        // return zero, except when a void Justina function
+                // return zero, except when a void Justina function (no free evaluation stack level: the zero is not needed, caller levels are cleared as well)
+                terminateJustinaFunction(isVoidFunctionDef || evalStack.isFull(), !isVoidFunctionDef);
             }
             else { break; }                                                                              // function with error trapping found (always there, see previous test)
         }
@@ -1133,9 +1240,7 @@ void Justina::checkForStop(bool& isActiveBreakpoint, bool& requestStopForDebugNo
                 // set next step to start of parsed condition string
                 // -------------------------------------------------
                 _programCounter = _programStorage + _PROGRAM_MEMORY_SIZE;                                   // first step in first statement in parsed eval() string
-                int tokenType = *_programCounter & 0x0F;             // adapt next token type (could be changed by a breakpoint condition string)
-                int tokenLength = (tokenType >= tok_isTerminalGroup1) ? sizeof(Token_terminal) : (tokenType == tok_isConstant) ? sizeof(Token_constant) :
-                    (tokenType == tok_isSymbolicConstant) ? sizeof(Token_symbolicConstant) : (*_programCounter >> 4) & 0x0F;
+                int tokenLength = (_tokenDecodeTable[(uint8_t)*_programCounter] >> 8) & 0x0F;
                 _activeFunctionData.pNextStep = _programCounter + tokenLength;                              // look ahead
 
                 _activeFunctionData.errorStatementStartStep = _programStorage + _PROGRAM_MEMORY_SIZE;
@@ -1177,17 +1282,32 @@ void Justina::checkForStop(bool& isActiveBreakpoint, bool& requestStopForDebugNo
 
         _appFlagStopRequestIsStored = false;                        // may forget now 
         _debugCmdExecuted = false;                                  // reset main program request to stop program
+        updateDebugMachineryArmed();
     }
 
     return;
 }
 
 
+// ----------------------------------------------------------------------------------------
+// *   maintain flag: does the program need to be checked for stops at each statement ?   *
+// ----------------------------------------------------------------------------------------
+
+// as long as no step or debug command was executed, no stop request is stored and breakpoints are off or not set,...
+// ...statement boundaries only test this flag (call after changing any of these)
+
+void Justina::updateDebugMachineryArmed() {
+    _debugMachineryArmed = (_stepCmdExecuted != db_continue) || _debugCmdExecuted || _appFlagStopRequestIsStored
+        || (_pBreakpoints->_breakpointsAreOn && (_pBreakpoints->_breakpointsUsed > 0));
+}
+
+
 // ------------------------------------------
 // *   parse condition string expressions   *
 // ------------------------------------------
 
 // watch string may not contain keywords, user functions, generic names
+// the condition string is parsed the first time the breakpoint is reached only: the parsed expression is kept in the breakpoint table for reuse
 
 Justina::parsingResult_type Justina::parseConditionString(int BPindex) {
 
@@ -1210,21 +1330,30 @@ Justina::parsingResult_type Justina::parseConditionString(int BPindex) {
     memcpy(_pParsedCommandLineStackTop + sizeof(char*), (_programStorage + _PROGRAM_MEMORY_SIZE), parsedUserCmdLen);
     *(_programStorage + _PROGRAM_MEMORY_SIZE) = tok_no_token;                                                   // init command line storage (to be used for batch file parsing)
 
-    // parse condition string
-    // ----------------------
+    // parse condition string (or retrieve the condition expression parsed when the breakpoint was previously reached)
+    // ----------------------------------------------------------------------------------------------------------------
     char* pDummy{};
     char* holdProgramCounter = _programCounter;
     _programCounter = _programStorage + _PROGRAM_MEMORY_SIZE;                                                   // parsed statements go to immediate mode program memory
 
-    // parse ONE condition string expression only
+    parsingResult_type parsingResult{ result_parsing_OK };
+    char*& pParsedCondition = _pBreakpoints->_pBreakpointData[BPindex].pParsedCondition;
+    if (parsedExpressionsAreValid(pParsedCondition, &_activeFunctionData)) {                                   // program not yet stopped: function data reside in _activeFunctionData
+        restoreParsedExpression(pParsedCondition + sizeof(ParsedExpressionsHeader), parsingResult);
+    }
+    else {
+        deleteParsedExpressions(pParsedCondition);                                                              // if parsed in another function (or with other array parameters)
 
+        // parse ONE condition string expression only
+        // note: application flags are not adapted (would not be passed to caller immediately)
+        int dummyInt{}; bool dummyBool{};
 
-    // note: application flags are not adapted (would not be passed to caller immediately)
-    int dummyInt{}; bool dummyBool{};
+        _parsingExecutingConditionString = true;         // after the last 'error' return in this procedure
+        parsingResult = parseStatement(pconditionParsingInput, pDummy, dummyInt, dummyBool);
+        _parsingExecutingConditionString = false;
 
-    _parsingExecutingConditionString = true;         // after the last 'error' return in this procedure
-    parsingResult_type parsingResult = parseStatement(pconditionParsingInput, pDummy, dummyInt, dummyBool);
-    _parsingExecutingConditionString = false;
+        appendParsedExpression(pParsedCondition, &_activeFunctionData, parsingResult);                          // keep for reuse
+    }
 
     if (parsingResult != result_parsing_OK) {
 
@@ -1325,9 +1454,8 @@ int Justina::jumpTokens(int n, char*& pStep, int& tokenCode) {
     for (int i = 1; i <= n; i++) {
         tokenType = *pStep & 0x0F;
         if (tokenType == tok_no_token) { return tok_no_token; }                                                 // end of program reached
-        // terminals and constants: token length is NOT stored in token type
-        int tokenLength = (tokenType >= tok_isTerminalGroup1) ? sizeof(Token_terminal) : (tokenType == tok_isConstant) ? sizeof(Token_constant) :
-            (tokenType == tok_isSymbolicConstant) ? sizeof(Token_symbolicConstant) : (*pStep >> 4) & 0x0F;
+        // token length: pre-decoded (terminals and constants: token length is NOT stored in token type)
+        int tokenLength = (_tokenDecodeTable[(uint8_t)*pStep] >> 8) & 0x0F;
         pStep = pStep + tokenLength;
     }
 
@@ -1380,9 +1508,8 @@ int Justina::findTokenStep(char*& pStep, bool excludeCurrent, char lookForTokenT
 
     // exclude current token step ?
     if (excludeCurrent) {
-        // terminals and constants: token length is NOT stored in token type
-        int tokenLength = (tokenType >= tok_isTerminalGroup1) ? sizeof(Token_terminal) : (tokenType == tok_isConstant) ? sizeof(Token_constant) :
-            (tokenType == tok_isSymbolicConstant) ? sizeof(Token_symbolicConstant) : (*pStep >> 4) & 0x0F;      // fetch next token 
+        // token length: pre-decoded (terminals and constants: token length is NOT stored in token type)
+        int tokenLength = (_tokenDecodeTable[(uint8_t)*pStep] >> 8) & 0x0F;      // fetch next token 
         pStep = pStep + tokenLength;
     }
 
@@ -1438,8 +1565,7 @@ int Justina::findTokenStep(char*& pStep, bool excludeCurrent, char lookForTokenT
             if (tokenCodeMatch) { return tokenType; }                                                           // if terminal, then return exact group (entry: use terminalGroup1) 
         }
 
-        int tokenLength = (tokenType >= tok_isTerminalGroup1) ? sizeof(Token_terminal) : (tokenType == tok_isConstant) ? sizeof(Token_constant) :
-            (tokenType == tok_isSymbolicConstant) ? sizeof(Token_symbolicConstant) : (*pStep >> 4) & 0x0F;      // fetch next token 
+        int tokenLength = (_tokenDecodeTable[(uint8_t)*pStep] >> 8) & 0x0F;      // fetch next token 
         pStep = pStep + tokenLength;
     } while (true);
 }
@@ -1498,26 +1624,28 @@ void Justina::saveLastValue(bool& overWritePrevious) {
     if ((lastValueNumeric) || (!lastValueNumeric && (lastvalue.value.pStringConst == nullptr))) {
         lastResultValueFiFo[0] = lastvalue.value;
     }
-    // new last value is a non-empty string: make a copy of the string and store a reference to this new string
+    // new last value is a non-empty string: an intermediate string is taken over (not copied); otherwise, make a copy of the string and store a reference to this new string
     else {
-        int stringlen = min(int(strlen(lastvalue.value.pStringConst)), MAX_ALPHA_CONST_LEN);                    // excluding terminating \0
         _lastValuesStringObjectCount++;
-        lastResultValueFiFo[0].pStringConst = new char[stringlen + 1];
-        memcpy(lastResultValueFiFo[0].pStringConst, lastvalue.value.pStringConst, stringlen);                   // copy the actual string (not the pointer); do not use strcpy
-        lastResultValueFiFo[0].pStringConst[stringlen] = '\0';
-    #if PRINT_HEAP_OBJ_CREA_DEL
-        _pDebugOut->print("\r\n+++++ (FiFo string) ");   _pDebugOut->println((uint32_t)lastResultValueFiFo[0].pStringConst, HEX);
-        _pDebugOut->print("save last value (2) ");   _pDebugOut->println(lastResultValueFiFo[0].pStringConst);
-    #endif            
-
         if (lastValueIntermediate) {
         #if PRINT_HEAP_OBJ_CREA_DEL
             _pDebugOut->print("\r\n----- (Intermd str) ");   _pDebugOut->println((uint32_t)lastvalue.value.pStringConst, HEX);
             _pDebugOut->print("save last value (3) "); _pDebugOut->println(lastvalue.value.pStringConst);
         #endif
             _intermediateStringObjectCount--;
-            delete[] lastvalue.value.pStringConst;
+            lastResultValueFiFo[0].pStringConst = takeIntermStringObject(_pEvalStackTop);
+            if (strnlen(lastResultValueFiFo[0].pStringConst, MAX_ALPHA_CONST_LEN + 1) > MAX_ALPHA_CONST_LEN) { lastResultValueFiFo[0].pStringConst[MAX_ALPHA_CONST_LEN] = '\0'; }    // clip in place
+        }
+        else {
+            int stringlen = strnlen(lastvalue.value.pStringConst, MAX_ALPHA_CONST_LEN);                         // excluding terminating \0; clipped length
+            lastResultValueFiFo[0].pStringConst = new char[stringlen + 1];
+            memcpy(lastResultValueFiFo[0].pStringConst, lastvalue.value.pStringConst, stringlen);               // copy the actual string (not the pointer); do not use strcpy
+            lastResultValueFiFo[0].pStringConst[stringlen] = '\0';
         }
+    #if PRINT_HEAP_OBJ_CREA_DEL
+        _pDebugOut->print("\r\n+++++ (FiFo string) ");   _pDebugOut->println((uint32_t)lastResultValueFiFo[0].pStringConst, HEX);
+        _pDebugOut->print("save last value (2) ");   _pDebugOut->println(lastResultValueFiFo[0].pStringConst);
+    #endif            
     }
 
     // store new last value type
@@ -1637,20 +1765,14 @@ void Justina::clearFlowCtrlStack(int& parsedCmdStackLevelsToPop, bool deleteSing
             else {
                 // delete local function data
                 int functionIndex = _activeFunctionData.functionIndex;
+                if (_tracingOn) { traceEvent(trace_function, 'E', functionIndex); }
                 int localVarCount = justinaFunctionData[functionIndex].localVarCountInFunction;
                 int paramOnlyCount = justinaFunctionData[functionIndex].paramOnlyCountInFunction;
                 if (localVarCount > 0) {
                     deleteStringArrayVarsStringObjects(_activeFunctionData.pLocalVarValues, _activeFunctionData.pVariableAttributes, localVarCount, paramOnlyCount, false, false, true);
                     deleteVariableValueObjects(_activeFunctionData.pLocalVarValues, _activeFunctionData.pVariableAttributes, localVarCount, paramOnlyCount, false, false, true);
 
-                #if PRINT_HEAP_OBJ_CREA_DEL
-                    _pDebugOut->print("\r\n----- (LOCAL STORAGE) ");   _pDebugOut->println((uint32_t)(_activeFunctionData.pLocalVarValues), HEX);
-                #endif
-                    _localVarValueAreaCount -= 3;
-                    // release local variable storage for function that has been called
-                    delete[] _activeFunctionData.pLocalVarValues;
-                    delete[] _activeFunctionData.pVariableAttributes;
-                    delete[] _activeFunctionData.ppSourceVarTypes;
+                    releaseLocalVarStorage();                                                   // release local variable storage for function that has been called
                 }
             }
         }
@@ -1664,6 +1786,7 @@ void Justina::clearFlowCtrlStack(int& parsedCmdStackLevelsToPop, bool deleteSing
             if (deleteSingleProgramStackLevels && keepExecutingBatchFile) { deleteCommandLineOpenBlocksOnly = true; }          // continue execution of batch file lines ? break 
             else {
                 int streamNumber = _activeFunctionData.statementInputStream;                // > 0 because batch file
+                if (_tracingOn) { traceEvent(trace_batchFile, 'E', streamNumber); }
                 SD_closeFile(streamNumber);                                                 // will close batch file (is a system file)
             }
         }
@@ -1673,6 +1796,7 @@ void Justina::clearFlowCtrlStack(int& parsedCmdStackLevelsToPop, bool deleteSing
         // ------------
         else if (blockType == block_eval) {
             // when an eval() level was deleted from flowCtrlStack, a parsedStatementLineStack level must be popped from the parsed statement lines stack as well
+            if (_tracingOn) { traceEvent(trace_eval, 'E', 0); }
         }
 
 
@@ -1835,6 +1959,18 @@ Justina::execResult_type Justina::arrayAndSubscriptsToarrayElement(LE_evalStack*
     return result_exec_OK;
 }
 
+// -------------------------------------------------------
+// *   total number of array elements (all dimensions)   *
+// -------------------------------------------------------
+
+int Justina::arrayElementCount(void* pArray) {
+    int arrayDimCount = ((char*)pArray)[3];
+    int arrayElements = 1;
+    for (int i = 0; i < arrayDimCount; i++) { arrayElements *= (int)(((char*)pArray)[i]); }
+    return arrayElements;
+}
+
+
 // ---------------------------------------
 // *   calculate array element address   *
 // ---------------------------------------
@@ -1869,8 +2005,7 @@ Justina::execResult_type  Justina::execAllProcessedOperators() {
 
     // _pEvalStackTop should point to an operand on entry (parsed constant, variable, expression result)
 
-    int pendingTokenIndex{ 0 };
-    int pendingTokenType{ tok_no_token }, pendingTokenPriority{};
+    int pendingTokenIndex{ 0 }, pendingTokenPriority{};
     bool currentOpHasPriority{ false };
 
 #if PRINT_DEBUG_INFO
@@ -1900,29 +2035,17 @@ Justina::execResult_type  Justina::execAllProcessedOperators() {
                 if (_pEvalStackMinus1->terminal.index & 0x80) { isPrefixOperator = true; }                      // e.g. print 5, -6 : prefix operation on second expression ('-6') and not '5-6' as infix operation
             }
 
-            // check operator priority
-            int priority{ 0 };
-            if (isPrefixOperator) { priority = _terminals[terminalIndex].prefix_priority & 0x1F; }              // bits b4..0 = priority
-            else { priority = _terminals[terminalIndex].infix_priority & 0x1F; }
-            bool RtoLassociativity = isPrefixOperator ? true : _terminals[terminalIndex].infix_priority & op_RtoL;
-
+            // operator priority and associativity (precedence function, pre-calculated)
+            int priority = isPrefixOperator ? _prefixOpStackPriority[terminalIndex] : _infixOpStackPriority[terminalIndex];
 
             // pending (not yet processed) token (always present and always a terminal token after a variable or constant token)
             // pending token can be any terminal token: infix operator, left or right parenthesis, comma or semicolon 
             // it can not be a prefix operator because it follows an operand (on top of stack)
-            pendingTokenType = *_activeFunctionData.pNextStep & 0x0F;                                           // there's always minimum one token pending (even if it is a semicolon)
-            pendingTokenIndex = (*_activeFunctionData.pNextStep >> 4) & 0x0F;                                   // terminal token only: index stored in high 4 bits of token type 
-            pendingTokenIndex += ((pendingTokenType == tok_isTerminalGroup2) ? 0x10 : (pendingTokenType == tok_isTerminalGroup3) ? 0x20 : 0);
-            bool pendingIsPostfixOperator = (_terminals[pendingTokenIndex].postfix_priority != 0);                      // postfix or infix operator ?
+            pendingTokenIndex = _tokenDecodeTable[(uint8_t)*_activeFunctionData.pNextStep] & 0x3F;              // there's always minimum one token pending (even if it is a semicolon)
+            pendingTokenPriority = _pendingTokenPriority[pendingTokenIndex];                                    // pending terminal is either an infix or a postfix operator (or another terminal)
 
-            // check pending operator priority
-            pendingTokenPriority = (pendingIsPostfixOperator ? (_terminals[pendingTokenIndex].postfix_priority & 0x1F) :// bits b4..0 = priority
-                (_terminals[pendingTokenIndex].infix_priority) & 0x1F);                                         // pending terminal is either an infix or a postfix operator
-
-
-            // determine final priority
-            currentOpHasPriority = (priority >= pendingTokenPriority);
-            if ((priority == pendingTokenPriority) && (RtoLassociativity)) { currentOpHasPriority = false; }
+            // determine final priority: operator on stack is executed first if equal priority and left-to-right associativity (see precedence functions)
+            currentOpHasPriority = (priority > pendingTokenPriority);
 
             if (!currentOpHasPriority) { break; }                                                               // exit while() loop
 
@@ -1966,7 +2089,7 @@ void Justina::makeIntermediateConstant(LE_evalStack* pEvalStackLvl) {
             int stringlen = strlen(operand.pStringConst);
             _intermediateStringObjectCount++;
             result.pStringConst = new char[stringlen + 1];
-            strcpy(result.pStringConst, operand.pStringConst);                                                  // copy the actual strings 
+            memcpy(result.pStringConst, operand.pStringConst, stringlen + 1);                                  // copy the actual strings (length known: no rescan)
         #if PRINT_HEAP_OBJ_CREA_DEL
             _pDebugOut->print("\r\n+++++ (Intermd str) ");   _pDebugOut->println((uint32_t)result.pStringConst, HEX);
             _pDebugOut->print(" make intermed. cst ");   _pDebugOut->println(result.pStringConst);
@@ -1984,6 +2107,189 @@ void Justina::makeIntermediateConstant(LE_evalStack* pEvalStackLvl) {
 }
 
 
+// -------------------------------------------------------------------------------------------------------
+// *   short-circuit evaluation: skip the right operand of '&&' or '||' if the left operand decides it   *
+// -------------------------------------------------------------------------------------------------------
+
+// called with the '&&' or '||' operator token as current token, before pushing it to the evaluation stack (the left operand is fully evaluated and on top of the stack)
+// if the left operand decides the result, replace it by the result (0 or 1), set the next step to the token following the right operand and return true 
+
+bool Justina::skipRightOperand(int terminalIndex) {
+
+    uint16_t jumpOffset{};
+    memcpy(&jumpOffset, ((Token_terminalWithJump*)_programCounter)->jumpOffset, sizeof(char[2]));
+    if (jumpOffset == 0) { return false; }                                                                      // jump offset not resolved during parsing: always evaluate
+
+    bool isNumber{ false };
+    bool operandIsTrue = lazyArgIsTrue(_pEvalStackTop, isNumber);
+    if (!isNumber) { return false; }                                                                            // let the operator produce the error
+
+    bool isAnd = (_terminals[terminalIndex].terminalCode == termcod_and);
+    if (operandIsTrue == isAnd) { return false; }                                                               // right operand decides the result
+
+    // replace the left operand by the operation result (if it is a variable, no intermediate string needs to be deleted: the operand is numeric)
+    _pEvalStackTop->varOrConst.tokenType = tok_isConstant;
+    _pEvalStackTop->varOrConst.valueType = value_isLong;
+    _pEvalStackTop->varOrConst.sourceVarScopeAndFlags = 0x00;
+    _pEvalStackTop->varOrConst.valueAttributes = constIsIntermediate;
+    _pEvalStackTop->varOrConst.value.longConst = isAnd ? 0 : 1;
+
+    _activeFunctionData.pNextStep = _programCounter + jumpOffset;                                               // infix operator, comma, right parenthesis or semicolon
+    return true;
+}
+
+
+// ----------------------------------------------------------------------------------------------------
+// *   lazy ifte(), switch() and choose() arguments: skip the arguments not needed for the result   *
+// ----------------------------------------------------------------------------------------------------
+
+// called with a lazy argument separator as current token (the preceding arguments are evaluated and on the evaluation stack)
+// if the arguments evaluated so far determine which of the next argument(s) are not needed to produce the function result, push a placeholder value (zero)...
+// ...for each of these arguments, and set the next step to the argument separator or right parenthesis following them. The function will find its usual argument count
+
+Justina::execResult_type Justina::execLazyArgSeparator() {
+
+    LE_evalStack* args[c_internalFncOrCmdMaxArgs]{};
+    int argCount{ 0 };
+
+    // find the left parenthesis and collect the arguments evaluated so far (in reverse order)
+    LE_evalStack* pStackLvl = _pEvalStackTop;
+    while (true) {
+        bool isTerminalLvl = ((pStackLvl->genericToken.tokenType == tok_isTerminalGroup1) || (pStackLvl->genericToken.tokenType == tok_isTerminalGroup2) || (pStackLvl->genericToken.tokenType == tok_isTerminalGroup3));
+        bool isLeftParLvl = isTerminalLvl ? (_terminals[pStackLvl->terminal.index & 0x7F].terminalCode == termcod_leftPar) : false;
+        if (isLeftParLvl) { break; }
+        if (argCount == c_internalFncOrCmdMaxArgs) { return result_exec_OK; }                                   // (parser prevents this)
+        args[argCount++] = pStackLvl;
+        pStackLvl = (LE_evalStack*)evalStack.getPrevListElement(pStackLvl);
+    }
+    for (int i = 0; i < argCount / 2; ++i) { LE_evalStack* p = args[i]; args[i] = args[argCount - 1 - i]; args[argCount - 1 - i] = p; }
+
+    LE_evalStack* pFunctionStackLvl = (LE_evalStack*)evalStack.getPrevListElement(pStackLvl);
+    int functionIndex = pFunctionStackLvl->function.index;
+    char functionCode = _internCppFunctions[functionIndex].functionCode;
+
+    // number of arguments to skip: 0 = none, -1 = all remaining arguments
+    int lastArg = argCount - 1;
+    int skipCount{ 0 };
+    int chooseIndex{ 0 };
+    bool isNumber{ false };
+
+    if (functionCode == fnccod_ifte) {
+        if ((lastArg % 2) == 0) {                                                                               // test expression: if false, skip its 'true part' 
+            bool isTrue = lazyArgIsTrue(args[lastArg], isNumber);
+            skipCount = (isNumber && !isTrue) ? 1 : 0;
+        }
+        else {                                                                                                  // 'true part': if its test expression was true, skip the rest
+            bool isTrue = lazyArgIsTrue(args[lastArg - 1], isNumber);
+            skipCount = (isNumber && isTrue) ? -1 : 0;
+        }
+    }
+
+    else if (functionCode == fnccod_switch) {
+        if (lastArg == 0) { skipCount = 0; }                                                                    // switch expression
+        else if ((lastArg % 2) == 1) { skipCount = lazyArgMatches(args[0], args[lastArg]) ? 0 : 1; }            // match value: if no match, skip its result 
+        else { skipCount = lazyArgMatches(args[0], args[lastArg - 1]) ? -1 : 0; }                               // result: if its match value matched, skip the rest
+    }
+
+    else if (functionCode == fnccod_choose) {                                                                   // skip the values preceding the selected value; once evaluated, skip the rest
+        bool argIsVar = (args[0]->varOrConst.tokenType == tok_isVariable);
+        char valueType = argIsVar ? (*args[0]->varOrConst.varTypeAddress & value_typeMask) : args[0]->varOrConst.valueType;
+        if ((valueType != value_isLong) && (valueType != value_isFloat)) { return result_exec_OK; }             // let the function produce the error
+        Val value{};
+        value.floatConst = argIsVar ? (*args[0]->varOrConst.value.pFloatConst) : args[0]->varOrConst.value.floatConst;    // works for long values as well
+        chooseIndex = (valueType == value_isLong) ? value.longConst : value.floatConst;
+        if (chooseIndex <= 0) { return result_exec_OK; }                                                        // let the function produce the error
+        skipCount = (lastArg == 0) ? chooseIndex - 1 : (lastArg >= chooseIndex) ? -1 : 0;
+    }
+
+    if (skipCount == 0) { return result_exec_OK; }
+
+    // follow the chain of jump offsets (each link skips one argument) to the argument separator or right parenthesis following the last argument to skip
+    char* pTarget = _programCounter;
+    int skipped{ 0 };
+    while ((skipCount < 0) || (skipped < skipCount)) {
+        if (((_tokenDecodeTable[(uint8_t)*pTarget] >> 12) & 0x0F) == tokKind_rightPar) { break; }              // no more arguments
+        uint16_t jumpOffset{};
+        memcpy(&jumpOffset, ((Token_terminalWithJump*)pTarget)->jumpOffset, sizeof(char[2]));
+        if (jumpOffset == 0) { return result_exec_OK; }                                                         // jump offset not resolved during parsing: evaluate all arguments
+        pTarget += jumpOffset;
+        skipped++;
+    }
+
+    // choose(): selected value is outside range ? evaluate all arguments and let the function produce the error 
+    if ((functionCode == fnccod_choose) && (lastArg == 0)) {
+        if (skipped < skipCount) { return result_exec_OK; }
+        if (((_tokenDecodeTable[(uint8_t)*pTarget] >> 12) & 0x0F) == tokKind_rightPar) { return result_exec_OK; }
+    }
+    if (skipped == 0) { return result_exec_OK; }
+
+    // push a placeholder value for each skipped argument
+    for (int i = 0; i < skipped; ++i) {
+        if (evalStack.isFull()) { return result_evalStackFull; }                                                // fixed capacity evaluation stack: no free level
+
+        _pEvalStackMinus2 = _pEvalStackMinus1; _pEvalStackMinus1 = _pEvalStackTop;
+        _pEvalStackTop = (LE_evalStack*)evalStack.appendListElement(sizeof(VarOrConstLvl));
+        _pEvalStackTop->varOrConst.tokenType = tok_isConstant;
+        _pEvalStackTop->varOrConst.tokenAddress = _programCounter;                                              // only for finding source error position during unparsing (for printing)
+        _pEvalStackTop->varOrConst.valueType = value_isLong;
+        _pEvalStackTop->varOrConst.sourceVarScopeAndFlags = 0x00;
+        _pEvalStackTop->varOrConst.valueAttributes = constIsIntermediate;
+        _pEvalStackTop->varOrConst.value.longConst = 0;
+    }
+
+    _activeFunctionData.pNextStep = pTarget;                                                                    // next lazy argument separator or right parenthesis
+    return result_exec_OK;
+}
+
+
+// -----------------------------------------------------------------------
+// *   lazy evaluation: is an evaluated (scalar) argument true (not 0) ?   *
+// -----------------------------------------------------------------------
+
+bool Justina::lazyArgIsTrue(LE_evalStack* pStackLvl, bool& isNumber) {
+
+    bool argIsVar = (pStackLvl->varOrConst.tokenType == tok_isVariable);
+    char valueType = argIsVar ? (*pStackLvl->varOrConst.varTypeAddress & value_typeMask) : pStackLvl->varOrConst.valueType;
+    isNumber = ((valueType == value_isLong) || (valueType == value_isFloat));
+    if (!isNumber) { return false; }
+
+    Val value{};
+    value.floatConst = argIsVar ? (*pStackLvl->varOrConst.value.pFloatConst) : pStackLvl->varOrConst.value.floatConst;      // works for long values as well
+    return (valueType == value_isLong) ? (value.longConst != 0) : (value.floatConst != 0.);
+}
+
+
+// ----------------------------------------------------------------------------------------------------
+// *   lazy evaluation: does a switch() match value match the switch expression (see switch() itself)   *
+// ----------------------------------------------------------------------------------------------------
+
+bool Justina::lazyArgMatches(LE_evalStack* pStackLvl1, LE_evalStack* pStackLvl2) {
+
+    bool arg1IsVar = (pStackLvl1->varOrConst.tokenType == tok_isVariable);
+    bool arg2IsVar = (pStackLvl2->varOrConst.tokenType == tok_isVariable);
+    char valueType1 = arg1IsVar ? (*pStackLvl1->varOrConst.varTypeAddress & value_typeMask) : pStackLvl1->varOrConst.valueType;
+    char valueType2 = arg2IsVar ? (*pStackLvl2->varOrConst.varTypeAddress & value_typeMask) : pStackLvl2->varOrConst.valueType;
+    bool arg1IsNumber = ((valueType1 == value_isLong) || (valueType1 == value_isFloat));
+    bool arg2IsNumber = ((valueType2 == value_isLong) || (valueType2 == value_isFloat));
+
+    Val value1{}, value2{};
+    if (arg1IsNumber) { value1.floatConst = arg1IsVar ? (*pStackLvl1->varOrConst.value.pFloatConst) : pStackLvl1->varOrConst.value.floatConst; }   // works for long values as well
+    else { value1.pStringConst = arg1IsVar ? (*pStackLvl1->varOrConst.value.ppStringConst) : pStackLvl1->varOrConst.value.pStringConst; }
+    if (arg2IsNumber) { value2.floatConst = arg2IsVar ? (*pStackLvl2->varOrConst.value.pFloatConst) : pStackLvl2->varOrConst.value.floatConst; }
+    else { value2.pStringConst = arg2IsVar ? (*pStackLvl2->varOrConst.value.ppStringConst) : pStackLvl2->varOrConst.value.pStringConst; }
+
+    if (!arg1IsNumber && !arg2IsNumber) {                                                                       // both strings
+        if ((value1.pStringConst == nullptr) || (value2.pStringConst == nullptr)) { return ((value1.pStringConst == nullptr) && (value2.pStringConst == nullptr)); }
+        return (strcmp(value1.pStringConst, value2.pStringConst) == 0);                                         // case sensitive comparison
+    }
+    else if (arg1IsNumber && arg2IsNumber) {
+        if ((valueType1 == value_isLong) && (valueType2 == value_isLong)) { return (value1.longConst == value2.longConst); }
+        return (((valueType1 == value_isFloat) ? value1.floatConst : (float)value1.longConst) == ((valueType2 == value_isFloat) ? value2.floatConst : (float)value2.longConst));
+    }
+    return false;
+}
+
+
 // -------------------------------
 // *   execute unary operation   *
 // -------------------------------
@@ -2083,6 +2389,105 @@ Justina::execResult_type  Justina::execUnaryOperation(bool isPrefix) {
 }
 
 
+// -----------------------------------------------------------------------------
+// *   execute infix operation: fast path for two long or two float operands   *
+// -----------------------------------------------------------------------------
+
+// most infix operations in loops and conditions have two long or two float operands and do not include an assignment: the operand value type pair...
+// ...selects a long or float handler, without the string, promotion and assignment processing of the general procedure (execInfixOperation)
+// returns false if not handled (mixed value types, strings, assignments, other operators): the general procedure then executes the operation
+// float comparisons and logical operators are always left to the general procedure  
+
+bool Justina::execNumericInfixOperation(execResult_type& execResult) {
+
+    int terminalIndex = _pEvalStackMinus1->terminal.index & 0x7F;
+    if ((_terminals[terminalIndex].infix_priority & 0x1F) == 0x01) { return false; }                           // pure or compound assignment
+
+    // operand value type pair: bit b1 = operand 1 is float, bit b0 = operand 2 is float (both bits clear: long, long)
+    bool operand1IsVar = (_pEvalStackMinus2->varOrConst.tokenType == tok_isVariable);
+    bool operand2IsVar = (_pEvalStackTop->varOrConst.tokenType == tok_isVariable);
+    uint8_t operand1valueType = operand1IsVar ? (*_pEvalStackMinus2->varOrConst.varTypeAddress & value_typeMask) : (_pEvalStackMinus2->varOrConst.valueType & value_typeMask);
+    uint8_t operand2valueType = operand2IsVar ? (*_pEvalStackTop->varOrConst.varTypeAddress & value_typeMask) : (_pEvalStackTop->varOrConst.valueType & value_typeMask);
+    if ((operand1valueType != value_isLong) && (operand1valueType != value_isFloat)) { return false; }
+    if ((operand2valueType != value_isLong) && (operand2valueType != value_isFloat)) { return false; }
+    int typePair = ((operand1valueType == value_isFloat) ? 0b10 : 0b00) | ((operand2valueType == value_isFloat) ? 0b01 : 0b00);
+
+    Val operand1, operand2, opResult;                                                                           // operands and result
+    operand1.floatConst = (operand1IsVar ? (*_pEvalStackMinus2->varOrConst.value.pFloatConst) : _pEvalStackMinus2->varOrConst.value.floatConst);     // valid for long integers as well
+    operand2.floatConst = (operand2IsVar ? (*_pEvalStackTop->varOrConst.value.pFloatConst) : _pEvalStackTop->varOrConst.value.floatConst);
+    bool opResultLong{ true };
+    execResult = result_exec_OK;
+
+    switch (typePair) {
+
+        case 0b00:                                                                                              // long, long
+            switch (_terminals[terminalIndex].terminalCode) {
+                case termcod_plus:      opResult.longConst = operand1.longConst + operand2.longConst; break;
+                case termcod_minus:     opResult.longConst = operand1.longConst - operand2.longConst; break;
+                case termcod_mult:      opResult.longConst = operand1.longConst * operand2.longConst; break;
+                case termcod_div:
+                    if (operand2.longConst == 0) { execResult = (operand1.longConst == 0) ? result_undefined : result_divByZero; return true; }
+                    opResult.longConst = operand1.longConst / operand2.longConst; break;
+                case termcod_mod:
+                    if (operand2.longConst == 0) { execResult = (operand1.longConst == 0) ? result_undefined : result_divByZero; return true; }
+                    opResult.longConst = operand1.longConst % operand2.longConst; break;
+                case termcod_bitAnd:    opResult.longConst = operand1.longConst & operand2.longConst; break;
+                case termcod_bitOr:     opResult.longConst = operand1.longConst | operand2.longConst; break;
+                case termcod_bitXor:    opResult.longConst = operand1.longConst ^ operand2.longConst; break;
+                case termcod_and:       opResult.longConst = (operand1.longConst && operand2.longConst); break;
+                case termcod_or:        opResult.longConst = (operand1.longConst || operand2.longConst); break;
+                case termcod_lt:        opResult.longConst = (operand1.longConst < operand2.longConst); break;
+                case termcod_gt:        opResult.longConst = (operand1.longConst > operand2.longConst); break;
+                case termcod_eq:        opResult.longConst = (operand1.longConst == operand2.longConst); break;
+                case termcod_ltoe:      opResult.longConst = (operand1.longConst <= operand2.longConst); break;
+                case termcod_gtoe:      opResult.longConst = (operand1.longConst >= operand2.longConst); break;
+                case termcod_ne:        opResult.longConst = (operand1.longConst != operand2.longConst); break;
+                default: return false;                                                                          // shift operators, power
+            }
+            break;
+
+        case 0b11:                                                                                              // float, float
+            opResultLong = false;
+            switch (_terminals[terminalIndex].terminalCode) {
+                case termcod_plus:      opResult.floatConst = operand1.floatConst + operand2.floatConst; break;
+                case termcod_minus:     opResult.floatConst = operand1.floatConst - operand2.floatConst; break;
+                case termcod_mult:
+                    opResult.floatConst = operand1.floatConst * operand2.floatConst;
+                    if (isnan(opResult.floatConst)) { execResult = result_undefined; return true; }
+                    else if (!isfinite(opResult.floatConst)) { execResult = result_overflow; return true; }
+                    if ((operand1.floatConst != 0) && (operand2.floatConst != 0) && (!isnormal(opResult.floatConst))) { execResult = result_underflow; return true; }
+                    break;
+                case termcod_div:
+                    if ((operand1.floatConst != 0) && (operand2.floatConst == 0)) { execResult = result_divByZero; return true; }
+                    opResult.floatConst = operand1.floatConst / operand2.floatConst;
+                    if (isnan(opResult.floatConst)) { execResult = result_undefined; return true; }
+                    else if (!isfinite(opResult.floatConst)) { execResult = result_overflow; return true; }
+                    if ((operand1.floatConst != 0) && (!isnormal(opResult.floatConst))) { execResult = result_underflow; return true; }
+                    break;
+                default: return false;
+            }
+            break;
+
+        default: return false;                                                                                  // mixed value types: operand promotion required
+    }
+
+    // drop highest 2 stack levels (operator and operand 2) and replace operand 1 by the result (intermediate constant). No strings involved
+    evalStack.deleteListElement(_pEvalStackTop);                                                                // operand 2 
+    evalStack.deleteListElement(_pEvalStackMinus1);                                                             // operator
+    _pEvalStackTop = _pEvalStackMinus2;
+    _pEvalStackMinus1 = (LE_evalStack*)evalStack.getPrevListElement(_pEvalStackTop);
+    _pEvalStackMinus2 = (LE_evalStack*)evalStack.getPrevListElement(_pEvalStackMinus1);
+
+    _pEvalStackTop->varOrConst.value = opResult;
+    _pEvalStackTop->varOrConst.valueType = opResultLong ? value_isLong : value_isFloat;
+    _pEvalStackTop->varOrConst.tokenType = tok_isConstant;                                                      // use generic constant type
+    _pEvalStackTop->varOrConst.sourceVarScopeAndFlags = 0x00;                                                   // not an array, not an array element (it's a constant) 
+    _pEvalStackTop->varOrConst.valueAttributes = constIsIntermediate;                                           // also clears tab() and col() function flags
+
+    return true;
+}
+
+
 // -------------------------------
 // *   execute infix operation   *
 // -------------------------------
@@ -2094,6 +2499,13 @@ Justina::execResult_type  Justina::execInfixOperation() {
     _activeFunctionData.errorProgramCounter = _pEvalStackMinus1->terminal.tokenAddress;                         // in the event of an error
 
 
+    // (0) two long or two float operands, no assignment ? fast path
+    // ---------------------------------------------------------------
+
+    execResult_type execResult{ result_exec_OK };
+    if (execNumericInfixOperation(execResult)) { return execResult; }
+
+
     // (1) Fetch operator info, whether operands are variables, and operand value types 
     // --------------------------------------------------------------------------------
 
@@ -2179,17 +2591,17 @@ Justina::execResult_type  Justina::execInfixOperation() {
                 bool op2emptyString = (operand2.pStringConst == nullptr);
 
                 // concatenate two operand strings objects and store pointer to it in result
-                int stringlen = 0;                                                                          // is both operands are empty strings
-                if (!op1emptyString) { stringlen = strlen(operand1.pStringConst); }
-                if (!op2emptyString) { stringlen += strlen(operand2.pStringConst); }
+                // each operand is scanned once for its length; the operands are then copied with memcpy (no strcpy / strcat rescanning the result)
+                int stringlen1 = op1emptyString ? 0 : strlen(operand1.pStringConst);
+                int stringlen2 = op2emptyString ? 0 : strlen(operand2.pStringConst);
 
-                if (stringlen == 0) { opResult.pStringConst = nullptr; }                                    // empty strings are represented by a nullptr (conserve heap space)
+                if (stringlen1 + stringlen2 == 0) { opResult.pStringConst = nullptr; }                      // empty strings are represented by a nullptr (conserve heap space)
                 else {                                                                                      // string to be assigned is not empty
                     _intermediateStringObjectCount++;
-                    opResult.pStringConst = new char[stringlen + 1];
-                    opResult.pStringConst[0] = '\0';                                                        // init: in case first operand is nullptr
-                    if (!op1emptyString) { strcpy(opResult.pStringConst, operand1.pStringConst); }
-                    if (!op2emptyString) { strcat(opResult.pStringConst, operand2.pStringConst); }
+                    opResult.pStringConst = new char[stringlen1 + stringlen2 + 1];
+                    memcpy(opResult.pStringConst, operand1.pStringConst, stringlen1);                       // zero length copy if first operand is nullptr
+                    memcpy(opResult.pStringConst + stringlen1, operand2.pStringConst, stringlen2);
+                    opResult.pStringConst[stringlen1 + stringlen2] = '\0';
                 #if PRINT_HEAP_OBJ_CREA_DEL
                     _pDebugOut->print("\r\n+++++ (Intermd str) ");   _pDebugOut->println((uint32_t)opResult.pStringConst, HEX);
                     _pDebugOut->print(" exec infix op. (1) ");   _pDebugOut->println(opResult.pStringConst);
@@ -2337,31 +2749,32 @@ Justina::execResult_type  Justina::execInfixOperation() {
             // note that for reference variables, the variable type fetched is the SOURCE variable type
             int varScope = _pEvalStackMinus2->varOrConst.sourceVarScopeAndFlags & var_scopeMask;
 
-            // make a copy of the character string and store a pointer to this copy as result (even if operand string is already an intermediate constant)
-            // because the value will be stored in a variable, limit to the maximum allowed string length
-            char* pUnclippedResultString = opResult.pStringConst;
-            int stringlen = min(int(strlen(pUnclippedResultString)), MAX_ALPHA_CONST_LEN);
+            // an intermediate string (compound assignment result, not pushed to the stack, or intermediate operand 2) is taken over by the variable:...
+            // ...only a string held by a variable or a parsed string constant is copied. Because the value will be stored in a variable, limit to the maximum allowed string length
+            bool isIntermediateString = (operatorCode != termcod_assign) || (takeIntermStringObject(_pEvalStackTop) != nullptr);
             (varScope == var_isUser) ? _userVarStringObjectCount++ : ((varScope == var_isGlobal) || (varScope == var_isStaticInFunc)) ? _globalStaticVarStringObjectCount++ : _localVarStringObjectCount++;
-            opResult.pStringConst = new char[stringlen + 1];
-            memcpy(opResult.pStringConst, pUnclippedResultString, stringlen);                                   // copy the actual string (not the pointer); do not use strcpy
-            opResult.pStringConst[stringlen] = '\0';                                                            // add terminating \0
+
+            if (isIntermediateString) {
+            #if PRINT_HEAP_OBJ_CREA_DEL
+                _pDebugOut->print("\r\n----- (Intermd str) "); _pDebugOut->println((uint32_t)opResult.pStringConst, HEX);
+                _pDebugOut->print(" exec infix op. (3) "); _pDebugOut->println(opResult.pStringConst);
+            #endif
+                _intermediateStringObjectCount--;
+                if (strnlen(opResult.pStringConst, MAX_ALPHA_CONST_LEN + 1) > MAX_ALPHA_CONST_LEN) { opResult.pStringConst[MAX_ALPHA_CONST_LEN] = '\0'; }  // clip in place (no need to scan beyond the limit)
+            }
+            else {
+                char* pUnclippedResultString = opResult.pStringConst;
+                int stringlen = strnlen(pUnclippedResultString, MAX_ALPHA_CONST_LEN);                          // clipped length: no need to scan beyond the limit
+                opResult.pStringConst = new char[stringlen + 1];
+                memcpy(opResult.pStringConst, pUnclippedResultString, stringlen);                               // copy the actual string (not the pointer); do not use strcpy
+                opResult.pStringConst[stringlen] = '\0';                                                        // add terminating \0
+            }
         #if PRINT_HEAP_OBJ_CREA_DEL
             _pDebugOut->print("\r\n");
             _pDebugOut->print((varScope == var_isUser) ? "+++++ (usr var str) " : ((varScope == var_isGlobal) || (varScope == var_isStaticInFunc)) ? "+++++ (var string ) " : "+++++ (loc var str) ");
             _pDebugOut->println((uint32_t)opResult.pStringConst, HEX);
             _pDebugOut->print(" exec infix op. (2) "); _pDebugOut->println(opResult.pStringConst);
         #endif
-
-            // compound statement ? then an intermediate string has been created (not pushed to the stack) and needs to be deleted now
-            if (operatorCode != termcod_assign) {
-            #if PRINT_HEAP_OBJ_CREA_DEL
-                _pDebugOut->print("\r\n----- (Intermd str) "); _pDebugOut->println((uint32_t)pUnclippedResultString, HEX);
-                _pDebugOut->print(" exec infix op. (3) "); _pDebugOut->println(pUnclippedResultString);
-            #endif
-                _intermediateStringObjectCount--;
-                // compound assignment: pointing to the unclipped result WHICH IS NON-EMPTY: so it's a heap object and must be deleted now
-                delete[] pUnclippedResultString;
-            }
         }
 
         // store value in variable and adapt variable value type - next line is valid for long integers as well
@@ -2506,7 +2919,7 @@ Justina::execResult_type Justina::execExternalCppFncOrCmd(LE_evalStack*& pFuncti
             char* temp = fcnResult.pStringConst;
             _intermediateStringObjectCount++;
             fcnResult.pStringConst = new char[len + 1];
-            strcpy(fcnResult.pStringConst, temp);
+            memcpy(fcnResult.pStringConst, temp, len + 1);
         #if PRINT_HEAP_OBJ_CREA_DEL
             _pDebugOut->print("\r\n+++++ (Intermd str) ");   _pDebugOut->println((uint32_t)fcnResult.pStringConst, HEX);
             _pDebugOut->print(" exec usrcpp fn (1) ");   _pDebugOut->println(fcnResult.pStringConst);
@@ -2580,6 +2993,12 @@ Justina::execResult_type  Justina::launchJustinaFunction(LE_evalStack*& pFunctio
     // remember token address of the Justina function token (this is where the Justina function is called), in case an error occurs (while passing arguments etc.)   
     _activeFunctionData.errorProgramCounter = pFunctionStackLvl->function.tokenAddress;
 
+    // frame stack: room for the local variable storage of the function to be called ? (check before anything changes)
+    if (MAX_FRAME_STACK_SIZE > 0) {
+        int storageSize = localVarStorageSize(justinaFunctionData[pFunctionStackLvl->function.index].localVarCountInFunction);
+        if (_frameStackTop + storageSize > MAX_FRAME_STACK_SIZE) { return result_frameStackFull; }
+    }
+
     // push caller function data (or main = user entry level in immediate mode) on FLOW CONTROL stack 
     // ----------------------------------------------------------------------------------------------
 
@@ -2601,25 +3020,16 @@ Justina::execResult_type  Justina::launchJustinaFunction(LE_evalStack*& pFunctio
     int localVarCount = justinaFunctionData[_activeFunctionData.functionIndex].localVarCountInFunction;
     int paramCount = justinaFunctionData[_activeFunctionData.functionIndex].paramOnlyCountInFunction;
 
-    if (localVarCount > 0) {
-        _localVarValueAreaCount += 3;
-        _activeFunctionData.pLocalVarValues = new Val[localVarCount];                               // local variable value: real, pointer to string or array, or (if reference): pointer to 'source' (referenced) variable
-        _activeFunctionData.ppSourceVarTypes = new char* [localVarCount];                           // only if local variable is reference to variable or array element: pointer to 'source' variable value type  
-        _activeFunctionData.pVariableAttributes = new char[localVarCount];                          // local variable: value type (float, local string or reference); 'source' (if reference) or local variable scope (user, global, static; local, param) 
-
-    #if PRINT_HEAP_OBJ_CREA_DEL
-        _pDebugOut->print("\r\n+++++ (LOCAL STORAGE) ");   _pDebugOut->println((uint32_t)_activeFunctionData.pLocalVarValues, HEX);
-    #endif
-    }
+    if (localVarCount > 0) { createLocalVarStorage(localVarCount); }
 
 
     // init local variables: parameters with supplied arguments (scalar and array var refs) and with default values (scalars only), local variables (scalar and array)
     // ---------------------------------------------------------------------------------------------------------------------------------------------------------------
 
     initFunctionParamVarWithSuppliedArg(suppliedArgCount, pFirstArgStackLvl);
-    char* calledFunctionTokenStep = justinaFunctionData[_activeFunctionData.functionIndex].pJustinaFunctionStartToken;
-    initFunctionDefaultParamVariables(calledFunctionTokenStep, suppliedArgCount, paramCount);       // return with first token after function definition...
-    initFunctionLocalNonParamVariables(calledFunctionTokenStep, paramCount, localVarCount);         // ...and create storage for local array variables
+    initFunctionDefaultParamVariables(suppliedArgCount, paramCount);
+    initFunctionLocalNonParamVariables(paramCount, localVarCount);                                  // also create storage for local array variables
+    char* calledFunctionTokenStep = justinaFunctionData[_activeFunctionData.functionIndex].pFunctionBodyStartToken;    // end of function definition statement
 
 
     // delete function name token from evaluation stack
@@ -2644,10 +3054,79 @@ Justina::execResult_type  Justina::launchJustinaFunction(LE_evalStack*& pFunctio
     _activeFunctionData.errorStatementStartStep = calledFunctionTokenStep;
     _activeFunctionData.errorProgramCounter = calledFunctionTokenStep;
 
+    if (_profilingOn) { profileFunctionEntered(calledFunctionTokenStep); }
+    if (_tracingOn) { traceEvent(trace_function, 'B', _activeFunctionData.functionIndex); }
+
     return  result_exec_OK;
 }
 
 
+// ---------------------------------------------------------------------------------------
+// *   local variable storage of a Justina function: size on the frame stack, in bytes   *
+// ---------------------------------------------------------------------------------------
+
+// three storage areas: local variable values, pointers to 'source' variable value types (references only) and local variable attributes
+// the size is rounded up to a multiple of the size of a value, so that the next storage area on the frame stack is aligned as well
+
+int Justina::localVarStorageSize(int localVarCount) {
+    int storageSize = localVarCount * (sizeof(Val) + sizeof(char*) + sizeof(char));
+    return ((storageSize + sizeof(Val) - 1) / sizeof(Val)) * sizeof(Val);
+}
+
+
+// -----------------------------------------------------------------------------
+// *   create local variable storage for the Justina function that is called   *
+// -----------------------------------------------------------------------------
+
+// if a frame stack is preallocated, the three storage areas are carved out of it (room was checked when launching the function). Otherwise, they are created on the heap 
+
+void Justina::createLocalVarStorage(int localVarCount) {
+
+    _localVarValueAreaCount += 3;
+
+    if (MAX_FRAME_STACK_SIZE > 0) {
+        char* pStorage = (char*)_pFrameStackArea + _frameStackTop;
+        _activeFunctionData.pLocalVarValues = (Val*)pStorage;
+        _activeFunctionData.ppSourceVarTypes = (char**)(pStorage + localVarCount * sizeof(Val));
+        _activeFunctionData.pVariableAttributes = pStorage + localVarCount * (sizeof(Val) + sizeof(char*));
+        _frameStackTop += localVarStorageSize(localVarCount);
+    }
+    else {
+        _activeFunctionData.pLocalVarValues = new Val[localVarCount];                               // local variable value: real, pointer to string or array, or (if reference): pointer to 'source' (referenced) variable
+        _activeFunctionData.ppSourceVarTypes = new char* [localVarCount];                           // only if local variable is reference to variable or array element: pointer to 'source' variable value type  
+        _activeFunctionData.pVariableAttributes = new char[localVarCount];                          // local variable: value type (float, local string or reference); 'source' (if reference) or local variable scope (user, global, static; local, param) 
+    }
+
+#if PRINT_HEAP_OBJ_CREA_DEL
+    _pDebugOut->print("\r\n+++++ (LOCAL STORAGE) ");   _pDebugOut->println((uint32_t)_activeFunctionData.pLocalVarValues, HEX);
+#endif
+}
+
+
+// ---------------------------------------------------------------------
+// *   release local variable storage of the active Justina function   *
+// ---------------------------------------------------------------------
+
+// Justina functions always terminate in reverse order of calling: the frame stack is rewound to the start of the storage areas of the active function 
+
+void Justina::releaseLocalVarStorage() {
+
+#if PRINT_HEAP_OBJ_CREA_DEL
+    _pDebugOut->print("\r\n----- (LOCAL STORAGE) ");   _pDebugOut->println((uint32_t)_activeFunctionData.pLocalVarValues, HEX);
+#endif
+    _localVarValueAreaCount -= 3;
+
+    if (MAX_FRAME_STACK_SIZE > 0) {
+        _frameStackTop = (char*)_activeFunctionData.pLocalVarValues - (char*)_pFrameStackArea;
+    }
+    else {
+        delete[] _activeFunctionData.pLocalVarValues;
+        delete[] _activeFunctionData.pVariableAttributes;
+        delete[] _activeFunctionData.ppSourceVarTypes;
+    }
+}
+
+
 // --------------------------------------------------------
 // *   launch parsing and execution of an eval() string   *
 // --------------------------------------------------------
@@ -2673,55 +3152,64 @@ Justina::execResult_type  Justina::launchEval(LE_evalStack*& pFunctionStackLvl,
     memcpy(_pParsedCommandLineStackTop + sizeof(char*), (_programStorage + _PROGRAM_MEMORY_SIZE), parsedUserCmdLen);
     *(_programStorage + _PROGRAM_MEMORY_SIZE) = tok_no_token;                                       // init command line storage (to be used for batch file parsing)
 
-    // parse eval() string
-    // -------------------
+    // parse eval() string (or retrieve the parsed statements from the eval() cache)
+    // -----------------------------------------------------------------------------
     char* pDummy{};
     char* holdProgramCounter = _programCounter;
     _programCounter = _programStorage + _PROGRAM_MEMORY_SIZE;                                       // parsed statements go to immediate mode program memory
-    _parsingEvalString = true;
-
-    // create a temporary string to hold expressions to parse, with an extra semicolon added at the end (in case it's missing)
-    _systemStringObjectCount++;
-    char* pEvalParsingInput = new char[strlen(parsingInput) + 2]; // room for additional semicolon (in case string is not ending with it) and terminating '\0'
-    strcpy(pEvalParsingInput, parsingInput);                                                        // copy the actual string
-    pEvalParsingInput[strlen(parsingInput)] = term_semicolon[0];
-    pEvalParsingInput[strlen(parsingInput) + 1] = '\0';
+
+    // not while a program is stopped: variable names in an eval() string can then also refer to local and static variables of the stopped function
+    bool useEvalCache = (MAX_EVAL_CACHE_ENTRIES > 0) && (_openDebugLevels == 0);
+    bool isCachedEvalString = useEvalCache && getEvalCacheEntry(parsingInput);                      // if found: parsed statements copied to immediate mode program memory
+
+    if (!isCachedEvalString) {
+        _parsingEvalString = true;
+
+        // create a temporary string to hold expressions to parse, with an extra semicolon added at the end (in case it's missing)
+        _systemStringObjectCount++;
+        char* pEvalParsingInput = new char[strlen(parsingInput) + 2]; // room for additional semicolon (in case string is not ending with it) and terminating '\0'
+        strcpy(pEvalParsingInput, parsingInput);                                                    // copy the actual string
+        pEvalParsingInput[strlen(parsingInput)] = term_semicolon[0];
+        pEvalParsingInput[strlen(parsingInput) + 1] = '\0';
 #if PRINT_HEAP_OBJ_CREA_DEL
-    _pDebugOut->print("\r\n+++++ (system exp str) "); _pDebugOut->println((uint32_t)pEvalParsingInput, HEX);
-    _pDebugOut->print("       launch eval (1) "); _pDebugOut->println(pEvalParsingInput);
+        _pDebugOut->print("\r\n+++++ (system exp str) "); _pDebugOut->println((uint32_t)pEvalParsingInput, HEX);
+        _pDebugOut->print("       launch eval (1) "); _pDebugOut->println(pEvalParsingInput);
 #endif
 
-    char* pParsingInput_temp = pEvalParsingInput;                                                   // temp, because value will be changed upon return (preserve original pointer value)
-    // note: application flags are not adapted (would not be passed to caller immediately)
-    int dummyInt{}; bool dummyBool{};
-    parsingResult_type result = parseStatement(pParsingInput_temp, pDummy, dummyInt, dummyBool);    // parse all eval() expressions in ONE go (which is not the case for standard parsing and watch string parsing)
+        char* pParsingInput_temp = pEvalParsingInput;                                               // temp, because value will be changed upon return (preserve original pointer value)
+        // note: application flags are not adapted (would not be passed to caller immediately)
+        int dummyInt{}; bool dummyBool{};
+        parsingResult_type result = parseStatement(pParsingInput_temp, pDummy, dummyInt, dummyBool);    // parse all eval() expressions in ONE go (which is not the case for standard parsing and watch string parsing)
 #if PRINT_HEAP_OBJ_CREA_DEL
-    _pDebugOut->print("\r\n----- (system exp str) "); _pDebugOut->println((uint32_t)pEvalParsingInput, HEX);
-    _pDebugOut->print("       launch eval (2) "); _pDebugOut->println(pEvalParsingInput);
+        _pDebugOut->print("\r\n----- (system exp str) "); _pDebugOut->println((uint32_t)pEvalParsingInput, HEX);
+        _pDebugOut->print("       launch eval (2) "); _pDebugOut->println(pEvalParsingInput);
 #endif
-    _systemStringObjectCount--;
-    delete[] pEvalParsingInput;
-    _parsingEvalString = false;
-
-    if (result != result_parsing_OK) {
-        // immediate mode program memory now contains a PARTIALLY parsed eval() expression string...
-        // ...(up to the token producing a parsing error) and a few string constants may have been created in the process.
-        // restore the situation from BEFORE launching the parsing of this now partially parsed eval() expression:   
-        // delete any newly parsed string constants created in the parsing attempt
-        // pop the original imm.mode parsed statement stack top level again to imm. mode program memory
-        // a corresponding entry in flow ctrl stack has not yet been created: no stack element to be deleted there
-
-        deleteConstStringObjects(_programStorage + _PROGRAM_MEMORY_SIZE);      // string constants that were created just now 
-        memcpy((_programStorage + _PROGRAM_MEMORY_SIZE), _pParsedCommandLineStackTop + sizeof(char*), parsedUserCmdLen);
-        parsedStatementLineStack.deleteListElement(_pParsedCommandLineStackTop);
-        _pParsedCommandLineStackTop = (char*)parsedStatementLineStack.getLastListElement();
+        _systemStringObjectCount--;
+        delete[] pEvalParsingInput;
+        _parsingEvalString = false;
+
+        if (result != result_parsing_OK) {
+            // immediate mode program memory now contains a PARTIALLY parsed eval() expression string...
+            // ...(up to the token producing a parsing error) and a few string constants may have been created in the process.
+            // restore the situation from BEFORE launching the parsing of this now partially parsed eval() expression:   
+            // delete any newly parsed string constants created in the parsing attempt
+            // pop the original imm.mode parsed statement stack top level again to imm. mode program memory
+            // a corresponding entry in flow ctrl stack has not yet been created: no stack element to be deleted there
+
+            deleteConstStringObjects(_programStorage + _PROGRAM_MEMORY_SIZE);  // string constants that were created just now 
+            memcpy((_programStorage + _PROGRAM_MEMORY_SIZE), _pParsedCommandLineStackTop + sizeof(char*), parsedUserCmdLen);
+            parsedStatementLineStack.deleteListElement(_pParsedCommandLineStackTop);
+            _pParsedCommandLineStackTop = (char*)parsedStatementLineStack.getLastListElement();
+
+        #if PRINT_PARSED_CMD_STACK
+            _pDebugOut->print("   >> POP parsed statements (launch eval parse error): steps = "); _pDebugOut->println(_lastUserCmdLineStep - (_programStorage + _PROGRAM_MEMORY_SIZE));
+        #endif
 
-    #if PRINT_PARSED_CMD_STACK
-        _pDebugOut->print("   >> POP parsed statements (launch eval parse error): steps = "); _pDebugOut->println(_lastUserCmdLineStep - (_programStorage + _PROGRAM_MEMORY_SIZE));
-    #endif
+            _evalParsingError = result;                                                             // remember
+            return result_eval_parsingError;
+        }
 
-        _evalParsingError = result;                                                                 // remember
-        return result_eval_parsingError;
+        if (useEvalCache) { storeEvalCacheEntry(parsingInput); }                                    // keep a copy of the parsed statements for reuse
     }
 
     // last step of just parsed eval() string. Note: adding sizeof(tok_no_token) because not yet added
@@ -2760,10 +3248,74 @@ Justina::execResult_type  Justina::launchEval(LE_evalStack*& pFunctionStackLvl,
     _activeFunctionData.errorStatementStartStep = _programStorage + _PROGRAM_MEMORY_SIZE;
     _activeFunctionData.errorProgramCounter = _programStorage + _PROGRAM_MEMORY_SIZE;
 
+    if (_tracingOn) { traceEvent(trace_eval, 'B', 0); }
+
     return  result_exec_OK;
 }
 
 
+// -----------------------------------------------------------------------------------------------------
+// *   eval() cache: copy the parsed statements of an eval() string to immediate mode program memory   *
+// -----------------------------------------------------------------------------------------------------
+
+// returns false if the eval() string is not found in the cache (it needs to be parsed)
+// if found, the program counter is set as if the eval() string was parsed just now
+
+bool Justina::getEvalCacheEntry(char* parsingInput) {
+    _evalCacheUseCount++;
+
+    for (int i = 0; i < MAX_EVAL_CACHE_ENTRIES; i++) {
+        EvalCacheEntry& entry = _pEvalCache[i];
+        if (entry.pEvalString == nullptr) { continue; }                                             // entry not in use
+        if (strcmp(entry.pEvalString, parsingInput) != 0) { continue; }
+
+        // found: the copy in immediate mode program memory gets its own string constants (they are deleted when eval() execution ends)
+        memcpy(_programStorage + _PROGRAM_MEMORY_SIZE, entry.pParsedStatements, entry.parsedLength + 1);    // including terminating 'no token'
+        copyConstStringObjects(_programStorage + _PROGRAM_MEMORY_SIZE);
+        _programCounter = _programStorage + _PROGRAM_MEMORY_SIZE + entry.parsedLength;
+        entry.lastUsed = _evalCacheUseCount;
+        _evalCacheHits++;
+        return true;
+    }
+
+    _evalCacheMisses++;
+    return false;
+}
+
+
+// ------------------------------------------------------------------------------
+// *   eval() cache: keep a copy of the parsed statements of an eval() string   *
+// ------------------------------------------------------------------------------
+
+// the eval() string was parsed without errors just now: parsed statements are in immediate mode program memory, up to the program counter
+// if all entries are in use, the least recently used entry is replaced
+
+void Justina::storeEvalCacheEntry(char* parsingInput) {
+    int entryIndex = 0;
+    for (int i = 0; i < MAX_EVAL_CACHE_ENTRIES; i++) {
+        if (_pEvalCache[i].pEvalString == nullptr) { entryIndex = i; break; }                        // entry not in use
+        if (_pEvalCache[i].lastUsed < _pEvalCache[entryIndex].lastUsed) { entryIndex = i; }
+    }
+
+    EvalCacheEntry& entry = _pEvalCache[entryIndex];
+    deleteEvalCacheEntry(entry);                                                                    // if in use
+
+    int parsedLength = _programCounter - (_programStorage + _PROGRAM_MEMORY_SIZE);
+    _systemStringObjectCount += 2;                                                                  // eval() string and parsed statements
+    entry.pEvalString = new char[strlen(parsingInput) + 1];
+    strcpy(entry.pEvalString, parsingInput);
+    entry.pParsedStatements = new char[parsedLength + 1];
+    memcpy(entry.pParsedStatements, _programStorage + _PROGRAM_MEMORY_SIZE, parsedLength + 1);      // including terminating 'no token'
+#if PRINT_HEAP_OBJ_CREA_DEL
+    _pDebugOut->print("\r\n+++++ (system str ) "); _pDebugOut->println((uint32_t)entry.pEvalString, HEX);
+    _pDebugOut->print("  new eval cache str "); _pDebugOut->println(entry.pEvalString);
+#endif
+    copyConstStringObjects(entry.pParsedStatements);                                                // the cached parsed statements own their string constants
+    entry.parsedLength = parsedLength;
+    entry.lastUsed = _evalCacheUseCount;
+}
+
+
 // -------------------------------------
 // *   launch execution a batch file   *
 // -------------------------------------
@@ -2826,7 +3378,7 @@ Justina::execResult_type Justina::launchBatchFileExecution(int cmdArgCount, LE_e
                 int stringlen = strlen(tempString);
                 _systemStringObjectCount++;
                 openFiles[fileNumber - 1].pArgs[i].pStringConst = new char[stringlen + 1];
-                strcpy(openFiles[fileNumber - 1].pArgs[i].pStringConst, tempString);
+                memcpy(openFiles[fileNumber - 1].pArgs[i].pStringConst, tempString, stringlen + 1);
             #if PRINT_HEAP_OBJ_CREA_DEL
                 _pDebugOut->print("\r\n+++++ (bat par str) ");   _pDebugOut->println((uint32_t)openFiles[fileNumber - 1].pArgs[i].pStringConst, HEX);
                 _pDebugOut->print("   batch file param ");   _pDebugOut->println(openFiles[fileNumber - 1].pArgs[i].pStringConst);
@@ -2873,6 +3425,8 @@ Justina::execResult_type Justina::launchBatchFileExecution(int cmdArgCount, LE_e
     _activeFunctionData.errorStatementStartStep = _programStorage + _PROGRAM_MEMORY_SIZE;
     _activeFunctionData.errorProgramCounter = _programStorage + _PROGRAM_MEMORY_SIZE;
 
+    if (_tracingOn) { traceEvent(trace_batchFile, 'B', fileNumber); }
+
     return result_exec_OK;
 }
 
@@ -2921,10 +3475,19 @@ void Justina::initFunctionParamVarWithSuppliedArg(int suppliedArgCount, LE_evalS
                     char* tempString{};
                     tempString = operandIsVariable ? *pStackLvl->varOrConst.value.ppStringConst : pStackLvl->varOrConst.value.pStringConst;
                     if (tempString != nullptr) {
-                        int stringlen = strlen(tempString);
                         _localVarStringObjectCount++;
-                        _activeFunctionData.pLocalVarValues[i].pStringConst = new char[stringlen + 1];
-                        strcpy(_activeFunctionData.pLocalVarValues[i].pStringConst, tempString);
+                        if (!operandIsVariable && (takeIntermStringObject(pStackLvl) != nullptr)) {                         // intermediate string: take it over (no copy)
+                        #if PRINT_HEAP_OBJ_CREA_DEL
+                            _pDebugOut->print("\r\n----- (Intermd str) ");   _pDebugOut->println((uint32_t)tempString, HEX);
+                            _pDebugOut->print("init Just fnc param ");   _pDebugOut->println(tempString);
+                        #endif
+                            _intermediateStringObjectCount--;
+                            _activeFunctionData.pLocalVarValues[i].pStringConst = tempString;
+                        }
+                        else {
+                            _activeFunctionData.pLocalVarValues[i].pStringConst = new char[strlen(tempString) + 1];
+                            strcpy(_activeFunctionData.pLocalVarValues[i].pStringConst, tempString);
+                        }
                     #if PRINT_HEAP_OBJ_CREA_DEL
                         _pDebugOut->print("\r\n+++++ (loc var str) ");   _pDebugOut->println((uint32_t)_activeFunctionData.pLocalVarValues[i].pStringConst, HEX);
                         _pDebugOut->print("init Just fnc param ");   _pDebugOut->println(_activeFunctionData.pLocalVarValues[i].pStringConst);
@@ -2945,56 +3508,30 @@ void Justina::initFunctionParamVarWithSuppliedArg(int suppliedArgCount, LE_evalS
 // *   init function parameter variables for non_supplied arguments (use scalar parameter default values)   *
 // ----------------------------------------------------------------------------------------------------------
 
-void Justina::initFunctionDefaultParamVariables(char*& pStep, int suppliedArgCount, int paramCount) {
-    int tokenType = *pStep & 0x0F;                                                                                          // function name token of called function
-
-    if (suppliedArgCount < paramCount) {                                                                                    // missing arguments: use parameter default values to init local variables
-        int count = 0, terminalCode = 0;
-        tokenType = jumpTokens(1, pStep);
-        // now positioned at opening parenthesis in called function (after FUNCTION token)
-        // find n-th argument separator (comma), with n is number of supplied arguments (stay at left parenthesis if none provided)
-        while (count < suppliedArgCount) { tokenType = findTokenStep(pStep, true, tok_isTerminalGroup1, termcod_comma); count++; }
-
-        // now positioned before first parameter for non-supplied scalar argument. It always has an initializer
-        // we only need the constant value, because we know the variable value index already (count): skip variable and assignment 
-        while (count < paramCount) {
-            tokenType = jumpTokens(((count == suppliedArgCount) ? 3 : 4), pStep);
-
-            // now positioned at constant initializer
-            char valueType = ((*(char*)pStep) >> 4) & value_typeMask;
-            bool operandIsLong = (valueType == value_isLong);
-            bool operandIsFloat = (valueType == value_isFloat);
-
-            _activeFunctionData.pVariableAttributes[count] = valueType;                                                     // long, float or string (array flag is reset here)
-
-            if (operandIsLong) {                                                                                            // operand is float constant
-                memcpy(&_activeFunctionData.pLocalVarValues[count].longConst, ((Token_constant*)pStep)->cstValue.longConst, sizeof(long));
-            }
-            else if (operandIsFloat) {                                                                                      // operand is float constant
-                memcpy(&_activeFunctionData.pLocalVarValues[count].floatConst, ((Token_constant*)pStep)->cstValue.floatConst, sizeof(float));
-            }
-            else {                                                                                                          // operand is parsed string constant: create a local copy and store in variable
-                char* s{ nullptr };
-                memcpy(&s, ((Token_constant*)pStep)->cstValue.pStringConst, sizeof(char*));                                 // copy the pointer, NOT the string  
-
-                _activeFunctionData.pLocalVarValues[count].pStringConst = nullptr;                                          // init (if empty string)
-                if (s != nullptr) {
-                    int stringlen = strlen(s);
-                    _localVarStringObjectCount++;
-                    _activeFunctionData.pLocalVarValues[count].pStringConst = new char[stringlen + 1];
-                    strcpy(_activeFunctionData.pLocalVarValues[count].pStringConst, s);
-                #if PRINT_HEAP_OBJ_CREA_DEL
-                    _pDebugOut->print("\r\n+++++ (loc var str) ");   _pDebugOut->println((uint32_t)_activeFunctionData.pLocalVarValues[count].pStringConst, HEX);
-                    _pDebugOut->print("init J.def.fnc.par. ");   _pDebugOut->println(_activeFunctionData.pLocalVarValues[count].pStringConst);
-                #endif
-                }
+void Justina::initFunctionDefaultParamVariables(int suppliedArgCount, int paramCount) {
+    // default values were collected when parsing the program ended
+    LocalVarInitData* pInitData = _pLocalVarInitData + (uint8_t)justinaFunctionData[_activeFunctionData.functionIndex].localVarNameRefs_startIndex;
+
+    for (int count = suppliedArgCount; count < paramCount; count++) {                                                       // missing arguments: use parameter default values to init local variables
+        char valueType = pInitData[count].valueType;
+        _activeFunctionData.pVariableAttributes[count] = valueType;                                                         // long, float or string (array flag is reset here)
+
+        if (valueType != value_isString) { _activeFunctionData.pLocalVarValues[count] = pInitData[count].initValue; }       // long or float constant
+        else {                                                                                                              // parsed string constant: create a local copy and store in variable
+            char* s = pInitData[count].initValue.pStringConst;
+            _activeFunctionData.pLocalVarValues[count].pStringConst = nullptr;                                              // init (if empty string)
+            if (s != nullptr) {
+                int stringlen = strlen(s);
+                _localVarStringObjectCount++;
+                _activeFunctionData.pLocalVarValues[count].pStringConst = new char[stringlen + 1];
+                memcpy(_activeFunctionData.pLocalVarValues[count].pStringConst, s, stringlen + 1);
+            #if PRINT_HEAP_OBJ_CREA_DEL
+                _pDebugOut->print("\r\n+++++ (loc var str) ");   _pDebugOut->println((uint32_t)_activeFunctionData.pLocalVarValues[count].pStringConst, HEX);
+                _pDebugOut->print("init J.def.fnc.par. ");   _pDebugOut->println(_activeFunctionData.pLocalVarValues[count].pStringConst);
+            #endif
             }
-            count++;
         }
     }
-
-    // skip (remainder of) function definition
-    findTokenStep(pStep, true, tok_isTerminalGroup1, termcod_semicolon, termcod_semicolon_BPset, termcod_semicolon_BPallowed);
 };
 
 
@@ -3003,129 +3540,50 @@ void Justina::initFunctionDefaultParamVariables(char*& pStep, int suppliedArgCou
 // *   init local variables (non-parameter)   *
 // --------------------------------------------
 
-void Justina::initFunctionLocalNonParamVariables(char* pStep, int paramCount, int localVarCount) {
-    // upon entry, positioned at first token after FUNCTION statement
-
-    int tokenType{}, terminalCode{};
+void Justina::initFunctionLocalNonParamVariables(int paramCount, int localVarCount) {
+    // value types, initializers and array dimensions were collected when parsing the program ended
+    LocalVarInitData* pInitData = _pLocalVarInitData + (uint8_t)justinaFunctionData[_activeFunctionData.functionIndex].localVarNameRefs_startIndex;
 
-    int count = paramCount;                                                                                                 // sum of mandatory and optional parameters
-    while (count != localVarCount) {
-        findTokenStep(pStep, true, tok_isInternCommand, cmdcod_var, cmdcod_constVar);                                       // find local 'var' or 'const' keyword (always there)
+    for (int count = paramCount; count < localVarCount; count++) {                                                          // skip parameters
+        char valueType = pInitData[count].valueType;
+        _activeFunctionData.pVariableAttributes[count] = valueType;
 
-        do {
-            // in case variable is not an array and it does not have an initializer: init now as zero (float). Arrays without initializer will be initialized later
-            _activeFunctionData.pLocalVarValues[count].floatConst = 0;
-            _activeFunctionData.pVariableAttributes[count] = value_isFloat;                                                 // for now, assume scalar
-
-            tokenType = jumpTokens(2, pStep, terminalCode);                                                                 // either left parenthesis, assignment, comma or semicolon separator (always a terminal)
+        // array: create and initialize (note: the only string initializer allowed is an empty string)
+        if ((valueType & var_isArray) == var_isArray) {
+            int arrayElements = pInitData[count].arrayElements;
+            _localArrayObjectCount++;
+            float* pArray = new float[arrayElements + 1];
+        #if PRINT_HEAP_OBJ_CREA_DEL
+            _pDebugOut->print("\r\n+++++ (loc ar stor) "); _pDebugOut->println((uint32_t)pArray, HEX);
+        #endif
+            _activeFunctionData.pLocalVarValues[count].pArray = pArray;
 
-            // handle array definition dimensions 
-            // ----------------------------------
+            // store dimensions in element 0: char 0 to 2 is dimensions; char 3 = dimension count 
+            memcpy(pArray, pInitData[count].arrayDimsAndCount, sizeof(pInitData[count].arrayDimsAndCount));
 
-            int dimCount = 0, arrayElements = 1;
-            int arrayDims[MAX_ARRAY_DIMS]{ 0 };
+            // fill up with numeric constants or (empty strings:) null pointers
+            Val initializer = pInitData[count].initValue;
+            if ((valueType & value_typeMask) == value_isLong) { for (int elem = 1; elem <= arrayElements; elem++) { ((long*)pArray)[elem] = initializer.longConst; } }
+            else if ((valueType & value_typeMask) == value_isFloat) { for (int elem = 1; elem <= arrayElements; elem++) { pArray[elem] = initializer.floatConst; } }
+            else { for (int elem = 1; elem <= arrayElements; elem++) { ((char**)pArray)[elem] = nullptr; } }
+        }
 
-            if (terminalCode == termcod_leftPar) {                                                                          // array opening parenthesis
-                do {
-                    tokenType = jumpTokens(1, pStep);                                                                       // dimension
-
-                    // increase dimension count and calculate elements (checks done during parsing)
-                    char valueType = ((*(char*)pStep) >> 4) & value_typeMask;
-                    bool isLong = (valueType == value_isLong);                                                              // or float (checked during parsing)
-                    Val dimSubscript{};
-                    if (isLong) { memcpy(&dimSubscript, ((Token_constant*)pStep)->cstValue.longConst, sizeof(long)); }
-                    else { memcpy(&dimSubscript, ((Token_constant*)pStep)->cstValue.floatConst, sizeof(float)); dimSubscript.longConst = (long)dimSubscript.floatConst; }
-                    arrayElements *= dimSubscript.longConst;
-                    arrayDims[dimCount] = dimSubscript.longConst;
-                    dimCount++;
-
-                    tokenType = jumpTokens(1, pStep, terminalCode);                                                         // comma (dimension separator) or right parenthesis
-                } while (terminalCode != termcod_rightPar);
-
-                // create array (init later)
-                _localArrayObjectCount++;
-                float* pArray = new float[arrayElements + 1];
+        // scalar: initialize
+        else if (valueType != value_isString) { _activeFunctionData.pLocalVarValues[count] = pInitData[count].initValue; }    // long or float constant
+        else {
+            char* pString = pInitData[count].initValue.pStringConst;
+            if (pString == nullptr) { _activeFunctionData.pLocalVarValues[count].pStringConst = nullptr; }                  // an empty string does not create a heap object
+            else { // create string object and store string
+                _localVarStringObjectCount++;
+                char* pVarString = new char[strlen(pString) + 1];                                                           // create char array on the heap to store alphanumeric constant, including terminating '\0'
+                strcpy(pVarString, pString);                                                                                // including terminating \0
+                _activeFunctionData.pLocalVarValues[count].pStringConst = pVarString;                                       // store pointer to string
             #if PRINT_HEAP_OBJ_CREA_DEL
-                _pDebugOut->print("\r\n+++++ (loc ar stor) "); _pDebugOut->println((uint32_t)pArray, HEX);
+                _pDebugOut->print("\r\n+++++ (loc var str) "); _pDebugOut->println((uint32_t)pVarString, HEX);
+                _pDebugOut->print(" init J.fnc loc var "); _pDebugOut->println(pVarString);
             #endif
-                _activeFunctionData.pLocalVarValues[count].pArray = pArray;
-                _activeFunctionData.pVariableAttributes[count] |= var_isArray;                                              // set array bit
-
-                // store dimensions in element 0: char 0 to 2 is dimensions; char 3 = dimension count 
-                for (int i = 0; i < MAX_ARRAY_DIMS; i++) {
-                    ((char*)pArray)[i] = arrayDims[i];
-                }
-                ((char*)pArray)[3] = dimCount;                                                                              // (note: for param arrays, set to max dimension count during parsing)
-
-                tokenType = jumpTokens(1, pStep, terminalCode);                                                             // assignment, comma or semicolon
-            }
-
-
-            // handle initialization (if initializer provided)
-            // -----------------------------------------------
-
-            if (terminalCode == termcod_assign) {
-                tokenType = jumpTokens(1, pStep);                                                                           // constant
-
-                // fetch constant
-                tokenType = *pStep & 0x0F;
-
-                Val initializer{ };                                                                                         // last token is a number constant: dimension
-                char* pString{ nullptr };
-
-                char valueType = ((*(char*)pStep) >> 4) & value_typeMask;
-                bool isLong = (valueType == value_isLong);
-                bool isFloat = (valueType == value_isFloat);
-
-                if (isLong) { memcpy(&initializer, ((Token_constant*)pStep)->cstValue.longConst, sizeof(long)); }
-                if (isFloat) { memcpy(&initializer, ((Token_constant*)pStep)->cstValue.floatConst, sizeof(float)); }
-                else { memcpy(&pString, ((Token_constant*)pStep)->cstValue.pStringConst, sizeof(pString)); }                // copy pointer to string (not the string itself)
-                int length = (isLong || isFloat) ? 0 : (pString == nullptr) ? 0 : strlen(pString);                          // only relevant for strings
-                _activeFunctionData.pVariableAttributes[count] =
-                    (_activeFunctionData.pVariableAttributes[count] & ~value_typeMask) | valueType;
-
-                // array: initialize (note: test for non-empty string - which are not allowed as initializer - done during parsing)
-                if ((_activeFunctionData.pVariableAttributes[count] & var_isArray) == var_isArray) {
-                    void* pArray = ((void**)_activeFunctionData.pLocalVarValues)[count];                                    // void pointer to an array 
-                    // fill up with numeric constants or (empty strings:) null pointers
-                    if (isLong) { for (int elem = 1; elem <= arrayElements; elem++) { ((long*)pArray)[elem] = initializer.longConst; } }
-                    else if (isFloat) { for (int elem = 1; elem <= arrayElements; elem++) { ((float*)pArray)[elem] = initializer.floatConst; } }
-                    else { for (int elem = 1; elem <= arrayElements; elem++) { ((char**)pArray)[elem] = nullptr; } }
-                }
-                // scalar: initialize
-                else {
-                    if (isLong) { _activeFunctionData.pLocalVarValues[count].longConst = initializer.longConst; }           // store numeric constant
-
-                    else if (isFloat) { _activeFunctionData.pLocalVarValues[count].floatConst = initializer.floatConst; }   // store numeric constant
-                    else {
-                        if (length == 0) { _activeFunctionData.pLocalVarValues[count].pStringConst = nullptr; }             // an empty string does not create a heap object
-                        else { // create string object and store string
-                            _localVarStringObjectCount++;
-                            char* pVarString = new char[length + 1];                                                        // create char array on the heap to store alphanumeric constant, including terminating '\0'
-                            // store alphanumeric constant in newly created character array
-                            strcpy(pVarString, pString);                                                                    // including terminating \0
-                            _activeFunctionData.pLocalVarValues[count].pStringConst = pVarString;                           // store pointer to string
-                        #if PRINT_HEAP_OBJ_CREA_DEL
-                            _pDebugOut->print("\r\n+++++ (loc var str) "); _pDebugOut->println((uint32_t)pVarString, HEX);
-                            _pDebugOut->print(" init J.fnc loc var "); _pDebugOut->println(pVarString);
-                        #endif
-                        }
-                    }
-                }
-
-                tokenType = jumpTokens(1, pStep, terminalCode);                                                             // comma or semicolon
             }
-
-            else {  // no initializer: if array, initialize it now (scalar has been initialized already)
-                if ((_activeFunctionData.pVariableAttributes[count] & var_isArray) == var_isArray) {
-                    void* pArray = ((void**)_activeFunctionData.pLocalVarValues)[count];                                    // void pointer to an array 
-                    for (int elem = 1; elem <= arrayElements; elem++) { ((float*)pArray)[elem] = 0.; }                      // float (by default)
-                }
-            }
-            count++;
-
-        } while (terminalCode == termcod_comma);
-
+        }
     }
 };
 
@@ -3134,7 +3592,11 @@ void Justina::initFunctionLocalNonParamVariables(char* pStep, int paramCount, in
 // *   terminate Justina function   *
 // ----------------------------------
 
-void Justina::terminateJustinaFunction(bool isVoidFunction, bool addZeroReturnValue) {
+Justina::execResult_type Justina::terminateJustinaFunction(bool isVoidFunction, bool addZeroReturnValue) {
+
+    if (!isVoidFunction && addZeroReturnValue && evalStack.isFull()) { return result_evalStackFull; }        // fixed capacity evaluation stack: no free level (function is not terminated)
+
+    if (_tracingOn) { traceEvent(trace_function, 'E', _activeFunctionData.functionIndex); }
 
     if (!isVoidFunction) {
         if (addZeroReturnValue) {
@@ -3158,14 +3620,7 @@ void Justina::terminateJustinaFunction(bool isVoidFunction, bool addZeroReturnVa
         deleteStringArrayVarsStringObjects(_activeFunctionData.pLocalVarValues, _activeFunctionData.pVariableAttributes, localVarCount, paramOnlyCount, false, false, true);
         deleteVariableValueObjects(_activeFunctionData.pLocalVarValues, _activeFunctionData.pVariableAttributes, localVarCount, paramOnlyCount, false, false, true);
 
-    #if PRINT_HEAP_OBJ_CREA_DEL
-        _pDebugOut->print("\r\n----- (LOCAL STORAGE) ");   _pDebugOut->println((uint32_t)_activeFunctionData.pLocalVarValues, HEX);
-    #endif
-        _localVarValueAreaCount -= 3;
-        // release local variable storage for function that has been called
-        delete[] _activeFunctionData.pLocalVarValues;
-        delete[] _activeFunctionData.pVariableAttributes;
-        delete[] _activeFunctionData.ppSourceVarTypes;
+        releaseLocalVarStorage();                                                                   // release local variable storage for function that has been called
     }
 
     // flowCtrlStack: remove open blocks (if any) for the active function and make the caller (eval(), other function, batch file or cmd line) the 'active function' again
@@ -3187,6 +3642,8 @@ void Justina::terminateJustinaFunction(bool isVoidFunction, bool addZeroReturnVa
 
     --_callStackDepth;                                                                                                      // caller reached: call stack depth decreased by 1
 
+    if (_profilingOn) { profileReturnToCaller(); }
+
 
     if ((_activeFunctionData.pNextStep >= (_programStorage + _PROGRAM_MEMORY_SIZE)) && (_callStackDepth == 0)) {            // not within a function, not within eval() execution, and not in debug mode       
         if (_localVarValueAreaCount != 0) {
@@ -3213,6 +3670,8 @@ void Justina::terminateJustinaFunction(bool isVoidFunction, bool addZeroReturnVa
             _localArrayObjectCount = 0;
         }
     }
+
+    return result_exec_OK;
 }
 
 
@@ -3222,6 +3681,8 @@ void Justina::terminateJustinaFunction(bool isVoidFunction, bool addZeroReturnVa
 
 void Justina::terminateEval() {
 
+    if (_tracingOn) { traceEvent(trace_eval, 'E', 0); }
+
     // flowCtrlStack: make the caller (other function, batch file or cmd line) the 'active function' again (an active 'eval()' does not have open blocks that need to be deleted)
 
     _activeFunctionData = *(OpenFunctionData*)_pFlowCtrlStackTop;
@@ -3234,6 +3695,8 @@ void Justina::terminateEval() {
     _withinMultiLineComment = (streamNumber > 0) ? bool(openFiles[streamNumber - 1].lineEndsInMultiLineComment) : false;
 
     clearParsedCommandLineStack(1);
+
+    if (_profilingOn) { profileReturnToCaller(); }
 }
 
 
@@ -3245,6 +3708,7 @@ void Justina::terminateBatchFile() {
 
     // the 'active function' MUST be a batch file at this point 
 
+    if (_tracingOn) { traceEvent(trace_batchFile, 'E', _activeFunctionData.statementInputStream); }
     SD_closeFile(_activeFunctionData.statementInputStream);                                             // will close batch file (is a system file) and associated exec cmd string arguments
 
     // flowCtrlStack: remove open blocks (if any) for the active batch file and make the caller (other batch file or cmd line) the 'active function' again
@@ -3273,7 +3737,9 @@ void Justina::terminateBatchFile() {
 // *   push terminal token to evaluation stack   *
 // -----------------------------------------------
 
-void Justina::pushTerminalToken(int tokenType) {                                                        // terminal token is assumed
+Justina::execResult_type Justina::pushTerminalToken(int tokenType) {                                    // terminal token is assumed
+
+    if (evalStack.isFull()) { return result_evalStackFull; }                                            // fixed capacity evaluation stack: no free level
 
     // push terminal index to stack
 
@@ -3285,6 +3751,8 @@ void Justina::pushTerminalToken(int tokenType) {
 
     _pEvalStackTop->terminal.index = (*_programCounter >> 4) & 0x0F;                                    // terminal token only: calculate from partial index stored in high 4 bits of token type 
     _pEvalStackTop->terminal.index += ((tokenType == tok_isTerminalGroup2) ? 0x10 : (tokenType == tok_isTerminalGroup3) ? 0x20 : 0);
+
+    return result_exec_OK;
 };
 
 
@@ -3292,7 +3760,9 @@ void Justina::pushTerminalToken(int tokenType) {
 // *   push internal cpp function name token to evaluation stack   *
 // -----------------------------------------------------------------
 
-void Justina::pushInternCppFunctionName(int tokenType) {                                                // internal cpp function token is assumed
+Justina::execResult_type Justina::pushInternCppFunctionName(int tokenType) {                            // internal cpp function token is assumed
+
+    if (evalStack.isFull()) { return result_evalStackFull; }                                            // fixed capacity evaluation stack: no free level
 
     // push internal cpp function index to stack
     _pEvalStackMinus2 = _pEvalStackMinus1; _pEvalStackMinus1 = _pEvalStackTop;
@@ -3302,6 +3772,8 @@ void Justina::pushInternCppFunctionName(int tokenType) {
     _pEvalStackTop->function.tokenAddress = _programCounter;                                            // only for finding source error position during unparsing (for printing)
 
     _pEvalStackTop->function.index = ((Token_internCppFunction*)_programCounter)->tokenIndex;           // internal cpp functions only
+
+    return result_exec_OK;
 };
 
 
@@ -3309,7 +3781,9 @@ void Justina::pushInternCppFunctionName(int tokenType) {
 // *   push external cpp function name token to evaluation stack   *
 // -----------------------------------------------------------------
 
-void Justina::pushExternCppFunctionName(int tokenType) {                                                // external cpp function token is assumed
+Justina::execResult_type Justina::pushExternCppFunctionName(int tokenType) {                            // external cpp function token is assumed
+
+    if (evalStack.isFull()) { return result_evalStackFull; }                                            // fixed capacity evaluation stack: no free level
 
     // push external cpp function return value type and index within functions for a specific return value type to stack
     _pEvalStackMinus2 = _pEvalStackMinus1; _pEvalStackMinus1 = _pEvalStackTop;
@@ -3320,6 +3794,8 @@ void Justina::pushExternCppFunctionName(int tokenType) {
 
     _pEvalStackTop->function.returnValueType = ((Token_externCppFunction*)_programCounter)->returnValueType;    // 0 = bool, 1 = char, 2 = int, 3 = long, 4 = float, 5 = char*, 6 = void (but returns zero to Justina)               
     _pEvalStackTop->function.funcIndexInType = ((Token_externCppFunction*)_programCounter)->funcIndexInType;
+
+    return result_exec_OK;
 };
 
 
@@ -3327,7 +3803,9 @@ void Justina::pushExternCppFunctionName(int tokenType) {
 // *   push Justina function name token to evaluation stack   *
 // ------------------------------------------------------------
 
-void Justina::pushJustinaFunctionName(int tokenType) {                                                  // Justina function token is assumed
+Justina::execResult_type Justina::pushJustinaFunctionName(int tokenType) {                              // Justina function token is assumed
+
+    if (evalStack.isFull()) { return result_evalStackFull; }                                            // fixed capacity evaluation stack: no free level
 
     // push Justina function index to stack
     _pEvalStackMinus2 = _pEvalStackMinus1; _pEvalStackMinus1 = _pEvalStackTop;
@@ -3337,6 +3815,8 @@ void Justina::pushJustinaFunctionName(int tokenType) {
     _pEvalStackTop->function.tokenAddress = _programCounter;                                            // only for finding source error position during unparsing (for printing)
 
     _pEvalStackTop->function.index = ((Token_JustinaFunction*)_programCounter)->identNameIndex;
+
+    return result_exec_OK;
 };
 
 
@@ -3344,7 +3824,9 @@ void Justina::pushJustinaFunctionName(int tokenType) {
 // *   push real or string constant token to evaluation stack   *
 // -------------------------------------------------------------
 
-void Justina::pushConstant(int tokenType) {                                                                                                 // float or string constant token is assumed
+Justina::execResult_type Justina::pushConstant(int tokenType) {                                                                             // float or string constant token is assumed
+
+    if (evalStack.isFull()) { return result_evalStackFull; }                                            // fixed capacity evaluation stack: no free level
 
     // push real or string parsed constant, value type and array flag (false) to stack
     _pEvalStackMinus2 = _pEvalStackMinus1; _pEvalStackMinus1 = _pEvalStackTop;
@@ -3367,6 +3849,8 @@ void Justina::pushConstant(int tokenType) {
     else {
         memcpy(&_pEvalStackTop->varOrConst.value.pStringConst, ((Token_constant*)_programCounter)->cstValue.pStringConst, sizeof(void*));   // char pointer not necessarily aligned with word size: copy pointer instead
     }
+
+    return result_exec_OK;
 };
 
 
@@ -3374,7 +3858,9 @@ void Justina::pushConstant(int tokenType) {
 // *   push generic name token to evaluation stack   *
 // ---------------------------------------------------
 
-void Justina::pushGenericName(int tokenType) {                                                      // float or string constant token is assumed
+Justina::execResult_type Justina::pushGenericName(int tokenType) {                                  // float or string constant token is assumed
+
+    if (evalStack.isFull()) { return result_evalStackFull; }                                            // fixed capacity evaluation stack: no free level
 
     // push real or string parsed constant, value type and array flag (false) to stack
     _pEvalStackMinus2 = _pEvalStackMinus1; _pEvalStackMinus1 = _pEvalStackTop;
@@ -3387,6 +3873,8 @@ void Justina::pushGenericName(int tokenType) {
     char* pAnum{ nullptr };
     memcpy(&pAnum, ((Token_constant*)_programCounter)->cstValue.pStringConst, sizeof(pAnum));       // char pointer not necessarily aligned with word size: copy pointer instead
     _pEvalStackTop->genericName.pStringConst = pAnum;                                               // store char* in stack 
+
+    return result_exec_OK;
 };
 
 
@@ -3394,7 +3882,9 @@ void Justina::pushGenericName(int tokenType) {
 // *   push variable token to evaluation stack   *
 // ----------------------------------------------
 
-void Justina::pushVariable(int tokenType) {                                                         // with variable token type
+Justina::execResult_type Justina::pushVariable(int tokenType) {                                     // with variable token type
+
+    if (evalStack.isFull()) { return result_evalStackFull; }                                            // fixed capacity evaluation stack: no free level
 
     // push variable base address, variable value type (real, string) and array flag to stack
     _pEvalStackMinus2 = _pEvalStackMinus1; _pEvalStackMinus1 = _pEvalStackTop;
@@ -3413,6 +3903,8 @@ void Justina::pushVariable(int tokenType) {
     _pDebugOut->print("   variable address: "); _pDebugOut->println((uint32_t)varAddress, HEX);
     _pDebugOut->print("   variable value: "); _pDebugOut->println(*(long*)varAddress);
 #endif
+
+    return result_exec_OK;
 }
 
 
@@ -120,6 +120,11 @@ const Justina::internCmdDef Justina::_internCommands[]{
     {"disableBP",       cmdcod_disableBP,       cmd_onlyImmediate,                                      1,9,    cmdArgSeq_101,  cmdBlockNone},
     {"moveBP",          cmdcod_moveBP,          cmd_onlyImmediate,                                      2,2,    cmdArgSeq_101,  cmdBlockNone},
 
+    {"profileOn",       cmdcod_profileOn,       cmd_onlyImmOrInsideFuncBlock,                           0,0,    cmdArgSeq_100,  cmdBlockNone},      // clear profiler counters and start profiling
+    {"profileOff",      cmdcod_profileOff,      cmd_onlyImmOrInsideFuncBlock,                           0,0,    cmdArgSeq_100,  cmdBlockNone},
+    {"traceOn",         cmdcod_traceOn,         cmd_onlyImmOrInsideFuncBlock,                           0,0,    cmdArgSeq_100,  cmdBlockNone},      // clear trace buffer and start tracing
+    {"traceOff",        cmdcod_traceOff,        cmd_onlyImmOrInsideFuncBlock,                           0,0,    cmdArgSeq_100,  cmdBlockNone},
+
     {"raiseError",      cmdcod_raiseError,      cmd_onlyImmOrInsideFuncBlock,                           1,1,    cmdArgSeq_101,  cmdBlockNone},
     {"trapErrors",      cmdcod_trapErrors,      cmd_onlyImmOrInsideFuncBlock,                           1,1,    cmdArgSeq_101,  cmdBlockNone},
     {"clearError",      cmdcod_clearError,      cmd_onlyImmOrInsideFuncBlock,                           0,0,    cmdArgSeq_100,  cmdBlockNone},
@@ -167,8 +172,16 @@ const Justina::internCmdDef Justina::_internCommands[]{
     {"vprintLine",      cmdcod_printLineToVar,  cmd_onlyImmOrInsideFuncBlock,                           1,16,   cmdArgSeq_101,  cmdBlockNone},
     {"vprintList",      cmdcod_printListToVar,  cmd_onlyImmOrInsideFuncBlock,                           2,16,   cmdArgSeq_101,  cmdBlockNone},
 
+    {"bufPrint",        cmdcod_printToBuf,      cmd_onlyImmOrInsideFuncBlock,                           2,16,   cmdArgSeq_101,  cmdBlockNone},      // string buffer, values (expressions) to append to string buffer
+    {"bufPrintLine",    cmdcod_printLineToBuf,  cmd_onlyImmOrInsideFuncBlock,                           1,16,   cmdArgSeq_101,  cmdBlockNone},
+    {"bufPrintList",    cmdcod_printListToBuf,  cmd_onlyImmOrInsideFuncBlock,                           2,16,   cmdArgSeq_101,  cmdBlockNone},
+    {"bufFlush",        cmdcod_flushBuf,        cmd_onlyImmOrInsideFuncBlock,                           1,2,    cmdArgSeq_101,  cmdBlockNone},      // string buffer [, stream]: print and empty string buffer (memory is kept)
+    {"bufClear",        cmdcod_clearBuf,        cmd_onlyImmOrInsideFuncBlock,                           1,1,    cmdArgSeq_101,  cmdBlockNone},      // string buffer: empty string buffer and release memory
+
     {"listCallStack",   cmdcod_printCallSt,     cmd_onlyImmOrInsideFuncBlock,                           0,1,    cmdArgSeq_101,  cmdBlockNone},      // print call stack to stream (default is console)
     {"listBP",          cmdcod_printBP,         cmd_onlyImmOrInsideFuncBlock,                           0,1,    cmdArgSeq_101,  cmdBlockNone},      // list breakpoints
+    {"listProfile",     cmdcod_printProfile,    cmd_onlyImmOrInsideFuncBlock,                           0,1,    cmdArgSeq_101,  cmdBlockNone},      // list profiler counters (SD file: CSV format)
+    {"traceDump",       cmdcod_traceDump,       cmd_onlyImmOrInsideFuncBlock,                           0,1,    cmdArgSeq_101,  cmdBlockNone},      // print trace buffer (Chrome trace event JSON format)
     {"listVars",        cmdcod_printVars,       cmd_onlyImmOrInsideFuncBlock,                           0,1,    cmdArgSeq_101,  cmdBlockNone},      // list variables "         "         "         "
     {"listFiles",       cmdcod_listFiles,       cmd_onlyImmOrInsideFuncBlock,                           0,1,    cmdArgSeq_101,  cmdBlockNone},      // list files     "         "         "         "
     {"listFilesToSerial",cmdcod_listFilesToSer, cmd_onlyImmOrInsideFuncBlock,                           0,0,    cmdArgSeq_100,  cmdBlockNone},      // list files to Serial with modification dates (SD library fixed)
@@ -264,6 +277,8 @@ const Justina::InternCppFuncDef Justina::_internCppFunctions[]{
     // string and 'character' functions
     {"char",                    fnccod_char,                    1,1,    0b0},
     {"len",                     fnccod_len,                     1,1,    0b0},
+    {"bufString",               fnccod_bufString,               1,1,    0b0},
+    {"bufLength",               fnccod_bufLength,               1,1,    0b0},
     {"line",                    fnccod_nl,                      0,0,    0b0},
     {"asc",                     fnccod_asc,                     1,2,    0b0},
     {"rtrim",                   fnccod_rtrim,                   1,1,    0b0},
@@ -302,6 +317,15 @@ const Justina::InternCppFuncDef Justina::_internCppFunctions[]{
     {"eval",                    fnccod_eval,                    1,1,    0b0},
     {"ubound",                  fnccod_ubound,                  2,2,    0b00000001},        // first parameter is array (LSB)
     {"dims",                    fnccod_dims,                    1,1,    0b00000001},
+    {"arraySum",                fnccod_arraySum,                1,1,    0b00000001},
+    {"arrayMin",                fnccod_arrayMin,                1,1,    0b00000001},
+    {"arrayMax",                fnccod_arrayMax,                1,1,    0b00000001},
+    {"arrayMean",               fnccod_arrayMean,               1,1,    0b00000001},
+    {"arrayStdDev",             fnccod_arrayStdDev,             1,1,    0b00000001},
+    {"arrayFill",               fnccod_arrayFill,               2,2,    0b00000001},        // array, value
+    {"arrayCopy",               fnccod_arrayCopy,               2,2,    0b00000011},        // destination array, source array
+    {"arrayScale",              fnccod_arrayScale,              2,3,    0b00000001},        // array, factor [, offset]
+    {"arrayDot",                fnccod_arrayDot,                2,2,    0b00000011},
     {"type",                    fnccod_valueType,               1,1,    0b0},
     {"r",                       fnccod_last,                    0,1,    0b0 },              // function: retrieve last result
     {"err",                     fnccod_getTrappedErr,           0,1,    0b0 },
@@ -378,9 +402,14 @@ const Justina::TerminalDef Justina::_terminals[]{
     {term_semicolon,        termcod_semicolon_BPallowed,0x00,               0x00,                       0x00},
     {term_semicolon,        termcod_semicolon,          0x00,               0x00,                       0x00},      // MUST directly follow two previous 'semicolon operator' entries
 
-    {term_comma,            termcod_comma,              0x00,               0x00,                       0x00},
+    // TWO internal codes for comma symbol: argument separator of a lazy function (ifte, switch, choose: stored by the parser with a jump offset), other commas
+    {term_comma,            termcod_comma_lazyArg,      0x00,               0x00,                       0x00},
+    {term_comma,            termcod_comma,              0x00,               0x00,                       0x00},      // MUST directly follow previous 'comma' entry
     {term_leftPar,          termcod_leftPar,            0x00,               0x10,                       0x00},
-    {term_rightPar,         termcod_rightPar,           0x00,               0x00,                       0x00},
+
+    // TWO internal codes for right parenthesis symbol: end marker following a folded constant (stored by the parser with a jump offset), right parenthesis
+    {term_rightPar,         termcod_foldedConstEnd,     0x00,               0x00,                       0x00},
+    {term_rightPar,         termcod_rightPar,           0x00,               0x00,                       0x00},      // MUST directly follow previous 'right parenthesis' entry
 
     // operators (0x00 -> operator not available, 0x01 -> pure or compound assignment)
     // op_long: operands must be long, a long is returned (e.g. 'bitand' operator)
@@ -626,6 +655,38 @@ void Justina::constructorCommonPart() {
         _pExternPrintColumns[i] = 0;
     }
 
+    // evaluation stack with fixed capacity ? preallocate all stack levels at once (pushing and popping stack levels will not create / delete heap objects) 
+    evalStack.setFixedCapacity(MAX_EVAL_STACK_LEVELS, sizeof(LE_evalStack));                       // no effect if zero capacity 
+
+    // frame stack with fixed size ? preallocate local variable storage for all open Justina functions (calling and returning will not create / delete heap objects)
+    if (MAX_FRAME_STACK_SIZE > 0) { _pFrameStackArea = new Val[(MAX_FRAME_STACK_SIZE + sizeof(Val) - 1) / sizeof(Val)]; }
+
+    // eval() cache: entries are empty until an eval() string is parsed
+    if (MAX_EVAL_CACHE_ENTRIES > 0) { _pEvalCache = new EvalCacheEntry[MAX_EVAL_CACHE_ENTRIES]{}; }
+
+    // profiler: counters per Justina function and per parsed statement are preallocated (profiling will not create heap objects)
+    if (MAX_PROFILE_STATEMENTS > 0) {
+        _pProfileFunctions = new ProfileFunctionCounters[MAX_JUSTINA_FUNCTIONS];
+        _pProfileStatements = new ProfileStatementCounters[MAX_PROFILE_STATEMENTS];
+        clearProfile();
+    }
+
+    // tracer: ring buffer is preallocated
+    if (MAX_TRACE_EVENTS > 0) { _pTraceEvents = new TraceEvent[MAX_TRACE_EVENTS]; }
+
+    // flow control stack and parsed statement line stack: recycle deleted stack levels (size class pools) instead of returning them to the heap 
+    const int flowCtrlSizeClasses[2]{ sizeof(OpenBlockTestData), sizeof(OpenFunctionData) };
+    const int parsedStatementSizeClasses[4]{ 64, 128, 256, sizeof(char*) + IMM_MEM_SIZE };          // parsed statement line stack levels: pointer + parsed statements 
+    flowCtrlStack.setSizeClassPool(flowCtrlSizeClasses, 2);
+    parsedStatementLineStack.setSizeClassPool(parsedStatementSizeClasses, 4);
+
+    // parser: build lookup indexes for internal command names, internal cpp function names and terminal tokens 
+    buildParserLookupIndexes();
+
+    // execution: pre-decode token kind, length and terminal index for all possible first token bytes, and pre-calculate operator precedence
+    buildTokenDecodeTable();
+    buildOperatorPrecedenceTables();
+
     // create a 'breakpoints' object, containing the breakpoints table, and responsible for handling breakpoints 
     _pBreakpoints = new Breakpoints(this, (_PROGRAM_MEMORY_SIZE * BP_LINE_RANGE_PROGMEM_STOR_RATIO) / 100, MAX_BP_COUNT);
 
@@ -659,6 +720,11 @@ Justina::~Justina() {
     // NOTE: object count of objects created / deleted in constructors / destructors is not maintained
     delete _pBreakpoints;                                                                           // not an array: use 'delete'
     delete[] _pExternPrintColumns;
+    delete[] _pFrameStackArea;                                                                      // nullptr if no frame stack
+    delete[] _pEvalCache;                                                                           // nullptr if no eval() cache (entries were cleared by resetMachine)
+    delete[] _pProfileFunctions;                                                                    // nullptr if no profiler
+    delete[] _pProfileStatements;
+    delete[] _pTraceEvents;                                                                         // nullptr if no tracer
 };
 
 
@@ -719,18 +785,24 @@ void Justina::begin() {
     _pDebugOut->print("+++++ (program memory) at 0x"); col = 10 - _pDebugOut->print((uint32_t)_programStorage, HEX); _pDebugOut->print(", size "); _pDebugOut->println(_PROGRAM_MEMORY_SIZE + IMM_MEM_SIZE);
 #endif
 
-    // find token index for terminal tokens 'termcod_semicolon_BPset' and  'semicolon with breakpoint allowed' 
-    int index{}, semicolonBPallowed_index{}, semicolonBPset_index{}, matches{};
+    // find token index for terminal tokens 'termcod_semicolon_BPset', 'semicolon with breakpoint allowed', 'lazy function argument separator' and 'folded constant end' 
+    int index{}, semicolonBPallowed_index{}, semicolonBPset_index{}, commaLazyArg_index{}, foldedConstEnd_index{}, matches{};
 
     for (index = _termTokenCount - 1, matches = 0; index >= 0; index--) {                   // for all defined terminals
         if (_terminals[index].terminalCode == termcod_semicolon_BPallowed) { semicolonBPallowed_index = index; matches++; }
         if (_terminals[index].terminalCode == termcod_semicolon_BPset) { semicolonBPset_index = index; matches++; }
-        if (matches == 2) { break; }                                                        // both entries found
+        if (_terminals[index].terminalCode == termcod_comma_lazyArg) { commaLazyArg_index = index; matches++; }
+        if (_terminals[index].terminalCode == termcod_foldedConstEnd) { foldedConstEnd_index = index; matches++; }
+        if (matches == 4) { break; }                                                        // all entries found
     }
     _semicolonBPallowed_token = (semicolonBPallowed_index <= 0x0F) ? tok_isTerminalGroup1 : (semicolonBPallowed_index <= 0x1F) ? tok_isTerminalGroup2 : tok_isTerminalGroup3;
     _semicolonBPallowed_token |= ((semicolonBPallowed_index & 0x0F) << 4);
     _semicolonBPset_token = (semicolonBPset_index <= 0x0F) ? tok_isTerminalGroup1 : (semicolonBPset_index <= 0x1F) ? tok_isTerminalGroup2 : tok_isTerminalGroup3;
     _semicolonBPset_token |= ((semicolonBPset_index & 0x0F) << 4);
+    _commaLazyArg_token = (commaLazyArg_index <= 0x0F) ? tok_isTerminalGroup1 : (commaLazyArg_index <= 0x1F) ? tok_isTerminalGroup2 : tok_isTerminalGroup3;
+    _commaLazyArg_token |= ((commaLazyArg_index & 0x0F) << 4);
+    _foldedConstEnd_token = (foldedConstEnd_index <= 0x0F) ? tok_isTerminalGroup1 : (foldedConstEnd_index <= 0x1F) ? tok_isTerminalGroup2 : tok_isTerminalGroup3;
+    _foldedConstEnd_token |= ((foldedConstEnd_index & 0x0F) << 4);
 
     _programMode = false;
     _programCounter = _programStorage + _PROGRAM_MEMORY_SIZE;
@@ -817,11 +889,14 @@ void Justina::JustinaMainLoop(bool& doAutoStart, bool& parsedStatementStartsOnNe
     long& statementStartsAtLine, long& parsedStatementAllowingBPstartsAtLine, long& BPstartLine, long& BPendLine, long& BPpreviousEndLine, bool& kill) {
 
     static bool flushAllUntilEOF{ false };
+    static uint32_t batchLineStart{ 0 };                                                            // batch files: file position and multi-line comment state at the start of the line being read
+    static bool withinMultiLineCommentAtBatchLineStart{ false };
 
     bool isSilentOnOffStatement{ false };
     bool withinStringEscSequence{ false }, lastCharWasSemiColon{ false }, within1LineComment{ false }, withinString{ false }, redundantSemiColon = false;
     int clearCmdIndicator{ 0 };
     long lineCount{ -1 }, statementCharCount{ 0 }, parsedStatementCount{ 0 };                       // 1 = clear program cmd, 2 = clear all cmd
+    bool batchLineStartNoted{ false };                                                              // batch files: start of line being read noted (and line looked up in batch line cache)
     char c{};
     char* pErrorPos{};
     parsingResult_type result{ result_parsing_OK };                                                 // init
@@ -843,12 +918,31 @@ void Justina::JustinaMainLoop(bool& doAutoStart, bool& parsedStatementStartsOnNe
 
         _initiateProgramLoad = false;
 
+        // batch file, at the start of a line: note the file position (key) and look for the parsed line in the batch line cache 
+        // (not while a program is stopped: a batch file line can then refer to local variables of the stopped function)
+        bool batchLineFromCache{ false };
+        // only once per line: passes without a character read (or before the first character of the line is added) would otherwise repeat the lookup
+        bool isBatchLineStart = !_programMode && (_activeFunctionData.statementInputStream > 0) && (lineCount == -1) && (statementCharCount == 0) && !batchLineStartNoted && !flushAllUntilEOF;
+        if (isBatchLineStart && !doAutoStart) {
+            batchLineStartNoted = true;
+            batchLineStart = openFiles[_activeFunctionData.statementInputStream - 1].file.position();
+            withinMultiLineCommentAtBatchLineStart = _withinMultiLineComment;
+            if (_openDebugLevels == 0) { batchLineFromCache = getBatchLineCacheEntry(_activeFunctionData.statementInputStream, batchLineStart); }
+        }
+
         if (doAutoStart) {
             statementCharCount = strlen(_sourceStatement);
             allCharsReceived = true;                                                                 // ready for parsing
             doAutoStart = false;                                                                     // nothing to prepare any more
         }
 
+        else if (batchLineFromCache) {                                                              // line parsed already and file position set to next line: nothing to read or parse
+            c = '\n';
+            allCharsReceived = true;
+            _appFlags &= ~appFlag_errorConditionBit;                                                // clear error condition flag 
+            _appFlags = (_appFlags & ~appFlag_statusMask) | appFlag_parsing;                        // status 'parsing'
+        }
+
         else {     // note: while waiting for first program character, allow a longer time out              
             bool charFetched{ false };
             c = getCharacter(charFetched, kill, forcedAbort, stdConsole, true, waitForFirstProgramCharacter);    // forced stop has no effect here
@@ -939,8 +1033,13 @@ void Justina::JustinaMainLoop(bool& doAutoStart, bool& parsedStatementStartsOnNe
                     execResult_type execResult{ result_exec_OK };
                     if (!_programMode && (result == result_parsing_OK)) {
 
+                        // batch file line read and parsed just now: keep the parsed line for reuse (before execution: the file position is still at the start of the next line)
+                        if (isBatchFile && !batchLineFromCache && (_openDebugLevels == 0) && (clearCmdIndicator == 0) && !isSilentOnOffStatement) {
+                            storeBatchLineCacheEntry(_activeFunctionData.statementInputStream, batchLineStart, withinMultiLineCommentAtBatchLineStart);
+                        }
+
                         // revoke app flag stop request if it was stored while idle
-                        if (!isBatchFile) { _appFlagStopRequestIsStored = false; }
+                        if (!isBatchFile) { _appFlagStopRequestIsStored = false; updateDebugMachineryArmed(); }
                         execResult = exec(_programStorage + _PROGRAM_MEMORY_SIZE);                  // execute parsed user statements (and call programs from there)
                         if (execResult == EVENT_kill) { kill = true; }
                         if (kill || (execResult == EVENT_quit)) { printlnTo(0); quitNow = true; }   // make sure Justina prompt will be printed on a new line
@@ -957,6 +1056,7 @@ void Justina::JustinaMainLoop(bool& doAutoStart, bool& parsedStatementStartsOnNe
 
                 // reset after program (or imm. mode line) is read and processed
                 lineCount = -1;                                                                     // flag: reset 'addCharacterToInput' static variables
+                batchLineStartNoted = false;
                 parsedStatementCount = 0;
                 flushAllUntilEOF = false;
                 _sourceStatement[statementCharCount] = '\0';                                        // add string terminator
@@ -1108,6 +1208,8 @@ bool Justina::finaliseParsing(parsingResult_type& result, bool& kill, long lineC
 
     if (result == result_parsing_OK) {
         if (_programMode) {
+            buildLocalVarInitData();                                                                // precalculate local variable initialization of all Justina functions
+
             // parsing OK message (program mode only - no message if not in program mode)  
             if (!_silent) { printParsingResult(result, funcNotDefIndex, _sourceStatement, lineCount, pErrorPos); }
 
@@ -1456,8 +1558,8 @@ void Justina::printDebugInfo(execResult_type execResult) {
     if (lineHasBPtableEntry) {                                                                      // check attributes in breakpoints table
         pBreakpointDataRow = _pBreakpoints->findBPtableRow(nextStatementPointer, BPdataRow);        // find table entry
     }
-    if (isBreakpointStop) { parseAndExecWatchOrBPwatchString(BPdataRow); }                          // BP watch string: may not contain keywords, Justina functions, generic names
-    parseAndExecWatchOrBPwatchString();                                                             // watch string: may not contain keywords, Justina functions, generic names
+    if (isBreakpointStop) { parseAndExecWatchOrBPwatchString(pDeepestOpenFunction, BPdataRow); }    // BP watch string: may not contain keywords, Justina functions, generic names
+    parseAndExecWatchOrBPwatchString(pDeepestOpenFunction);                                         // watch string: may not contain keywords, Justina functions, generic names
 
     // print the source line, function and statement 
     // ---------------------------------------------
@@ -1479,13 +1581,21 @@ void Justina::printDebugInfo(execResult_type execResult) {
 // -----------------------------------------------
 
 // watch string may not contain keywords, user functions, generic names
+// watch expressions are parsed at the first stop only: the parsed expressions are kept for reuse at next stops in the same function (with the same array parameters)
 
-void Justina::parseAndExecWatchOrBPwatchString(int BPindex) {
+void Justina::parseAndExecWatchOrBPwatchString(OpenFunctionData* pOpenFunction, int BPindex) {
     char* pNextParseStatement{};
 
     char* pwatchParsingInput = ((BPindex == -1) ? _pwatchString : _pBreakpoints->_pBreakpointData[BPindex].pWatch);     // copy pointer to start of watch string
     if (pwatchParsingInput == nullptr) { return; }                                                                      // no watch string: nothing to watch
 
+    // watch expressions parsed at a previous stop can be reused ? if not, delete them and parse the watch string again
+    char*& pParsedWatch = ((BPindex == -1) ? _pParsedWatchString : _pBreakpoints->_pBreakpointData[BPindex].pParsedWatch);
+    bool isParsedWatch = parsedExpressionsAreValid(pParsedWatch, pOpenFunction);
+    if (!isParsedWatch) { deleteParsedExpressions(pParsedWatch); }
+    char* pParsedExpression = isParsedWatch ? pParsedWatch + sizeof(ParsedExpressionsHeader) : nullptr;
+    char* pParsedWatchEnd = isParsedWatch ? pParsedWatch + ((ParsedExpressionsHeader*)pParsedWatch)->blockSize : nullptr;
+
     // watch string expressions will be parsed and executed from immediate mode program storage: 
     // before overwriting user statements that were just parsed and executed, delete parsed strings
     deleteConstStringObjects(_programStorage + _PROGRAM_MEMORY_SIZE);
@@ -1496,28 +1606,36 @@ void Justina::parseAndExecWatchOrBPwatchString(int BPindex) {
 
     printTo(_debug_sourceStreamNumber, (BPindex == -1) ? "<watch> " : "<BP wa> ");
 
-    // in each loop, parse and execute ONE expression 
+    // in each loop, parse (or retrieve) and execute ONE expression 
     do {
         // init
         *(_programStorage + _PROGRAM_MEMORY_SIZE) = tok_no_token;                                                   // in case no valid tokens will be stored
         _programCounter = _programStorage + _PROGRAM_MEMORY_SIZE;                                                   // start of 'immediate mode' program area
 
         // skip any spaces and semi-colons in the input stream
-        while ((pwatchParsingInput[0] == ' ') || (pwatchParsingInput[0] == term_semicolon[0])) { pwatchParsingInput++; }
-        if (*pwatchParsingInput == '\0') { break; }                                                                 // could occur if semicolons skipped
+        if (!isParsedWatch) {
+            while ((pwatchParsingInput[0] == ' ') || (pwatchParsingInput[0] == term_semicolon[0])) { pwatchParsingInput++; }
+            if (*pwatchParsingInput == '\0') { break; }                                                             // could occur if semicolons skipped
+        }
+        else if (pParsedExpression == pParsedWatchEnd) { break; }                                                  // no expressions
 
         // parse multiple watch string expressions ? print a comma in between
         if (valuePrinted) { printTo(_debug_sourceStreamNumber, ", "); }                                             // separate values (if more than one)
 
         // note: application flags are not adapted (would not be passed to caller immediately)
-        int dummyInt{}; bool dummyBool{};
-        parsingResult_type result = parseStatement(pwatchParsingInput, pNextParseStatement, dummyInt, dummyBool);   // parse ONE statement
+        parsingResult_type result{ result_parsing_OK };
+        if (isParsedWatch) { pParsedExpression = restoreParsedExpression(pParsedExpression, result); }             // copy parsed expression to immediate mode program storage
+        else {
+            int dummyInt{}; bool dummyBool{};
+            result = parseStatement(pwatchParsingInput, pNextParseStatement, dummyInt, dummyBool);                  // parse ONE statement
+            appendParsedExpression(pParsedWatch, pOpenFunction, result);                                            // keep for reuse at next stops
+        }
         if (result == result_parsing_OK) {
             if (!_printWatchValueOnly) {
                 // do NOT pretty print if parsing error, to avoid bad-looking partially printed statements (even if there will be an execution error later)
                 prettyPrintStatements(_debug_sourceStreamNumber, 0);
                 printTo(_debug_sourceStreamNumber, ": ");                                                           // resulting value will follow
-                pwatchParsingInput = pNextParseStatement;
+                if (!isParsedWatch) { pwatchParsingInput = pNextParseStatement; }
             }
         }
         else {
@@ -1526,8 +1644,10 @@ void Justina::parseAndExecWatchOrBPwatchString(int BPindex) {
             sprintf(errStr, "<ErrP%d>", (int)result);
             printTo(_debug_sourceStreamNumber, errStr);
             // pNextParseStatement not yet correctly positioned: set to next statement
-            while ((pwatchParsingInput[0] != term_semicolon[0]) && (pwatchParsingInput[0] != '\0')) { ++pwatchParsingInput; }
-            if (pwatchParsingInput[0] == term_semicolon[0]) { ++pwatchParsingInput; }
+            if (!isParsedWatch) {
+                while ((pwatchParsingInput[0] != term_semicolon[0]) && (pwatchParsingInput[0] != '\0')) { ++pwatchParsingInput; }
+                if (pwatchParsingInput[0] == term_semicolon[0]) { ++pwatchParsingInput; }
+            }
         }
 
         // if parsing went OK: execute ONE parsed expression (just parsed now)
@@ -1542,7 +1662,7 @@ void Justina::parseAndExecWatchOrBPwatchString(int BPindex) {
         deleteConstStringObjects(_programStorage + _PROGRAM_MEMORY_SIZE);                                           // always
         *(_programStorage + _PROGRAM_MEMORY_SIZE) = tok_no_token;                                                   // current end of program (immediate mode)
 
-    } while (*pwatchParsingInput != '\0');                                                                          // exit loop if all expressions handled
+    } while (isParsedWatch ? (pParsedExpression < pParsedWatchEnd) : (*pwatchParsingInput != '\0'));              // exit loop if all expressions handled
 
     _parsingExecutingWatchString = false;
     printlnTo(_debug_sourceStreamNumber);       // go to next output line
@@ -1551,6 +1671,102 @@ void Justina::parseAndExecWatchOrBPwatchString(int BPindex) {
 }
 
 
+// -------------------------------------------------------------------------------------
+// *   array dimension counts of the parameters of an open function (0 for a scalar)   *
+// -------------------------------------------------------------------------------------
+
+// 2 bits per parameter: whether a parameter is an array (and its dimension count) depends on the argument supplied by the caller...
+// ...and parsing a local variable reference checks it: parsed watch and condition expressions are only valid for the same array parameters
+
+uint32_t Justina::paramArrayDims(OpenFunctionData* pOpenFunction) {
+    uint32_t arrayDims{ 0 };
+    int paramCount = justinaFunctionData[pOpenFunction->functionIndex].paramOnlyCountInFunction;
+    for (int i = 0; i < paramCount; i++) {
+        if (!(pOpenFunction->pVariableAttributes[i] & var_isArray)) { continue; }
+        bool isSourceVarRef = pOpenFunction->pVariableAttributes[i] & value_isVarRef;
+        void* pArray = isSourceVarRef ? *(pOpenFunction->pLocalVarValues[i].ppArray) : pOpenFunction->pLocalVarValues[i].pArray;
+        arrayDims |= (uint32_t)(((char*)pArray)[3] & 0x03) << (2 * i);
+    }
+    return arrayDims;
+}
+
+
+// -----------------------------------------------------------------------------------
+// *   can parsed watch or condition expressions be reused in this open function ?   *
+// -----------------------------------------------------------------------------------
+
+bool Justina::parsedExpressionsAreValid(char* pParsedExpressions, OpenFunctionData* pOpenFunction) {
+    if (pParsedExpressions == nullptr) { return false; }
+    ParsedExpressionsHeader* pHeader = (ParsedExpressionsHeader*)pParsedExpressions;
+    return (pHeader->functionIndex == pOpenFunction->functionIndex) && (pHeader->paramArrayDims == paramArrayDims(pOpenFunction));
+}
+
+
+// ---------------------------------------------------------------------------------------------------
+// *   keep a copy of the expression just parsed in immediate mode program memory, for reuse later   *
+// ---------------------------------------------------------------------------------------------------
+
+// if a parsing error occurred, only the parsing result is kept
+// the copy owns its string constants (they are deleted with the parsed expressions)
+
+void Justina::appendParsedExpression(char*& pParsedExpressions, OpenFunctionData* pOpenFunction, parsingResult_type parsingResult) {
+    ParsedExpressionHeader expressionHeader{ (int)parsingResult, 0 };
+    if (parsingResult == result_parsing_OK) { expressionHeader.tokenBytes = _programCounter - (_programStorage + _PROGRAM_MEMORY_SIZE) + 1; }  // including terminating 'no token'
+
+    int oldSize = (pParsedExpressions == nullptr) ? sizeof(ParsedExpressionsHeader) : ((ParsedExpressionsHeader*)pParsedExpressions)->blockSize;
+    int newSize = oldSize + sizeof(ParsedExpressionHeader) + expressionHeader.tokenBytes;
+
+    // parsed expressions grow by one expression: create a new block and copy the existing parsed expressions (string constants do not move)
+    char* pNewBlock = new char[newSize];
+#if PRINT_HEAP_OBJ_CREA_DEL
+    _pDebugOut->print("\r\n+++++ (system str ) "); _pDebugOut->println((uint32_t)pNewBlock, HEX);
+#endif
+    if (pParsedExpressions == nullptr) {
+        _systemStringObjectCount++;
+        ((ParsedExpressionsHeader*)pNewBlock)->functionIndex = pOpenFunction->functionIndex;
+        ((ParsedExpressionsHeader*)pNewBlock)->paramArrayDims = paramArrayDims(pOpenFunction);
+    }
+    else {
+        memcpy(pNewBlock, pParsedExpressions, oldSize);
+    #if PRINT_HEAP_OBJ_CREA_DEL
+        _pDebugOut->print("\r\n----- (system str ) "); _pDebugOut->println((uint32_t)pParsedExpressions, HEX);
+    #endif
+        delete[] pParsedExpressions;
+    }
+    ((ParsedExpressionsHeader*)pNewBlock)->blockSize = newSize;
+
+    char* pParsedExpression = pNewBlock + oldSize;
+    memcpy(pParsedExpression, &expressionHeader, sizeof(ParsedExpressionHeader));
+    pParsedExpression += sizeof(ParsedExpressionHeader);
+    if (expressionHeader.tokenBytes > 0) {
+        memcpy(pParsedExpression, _programStorage + _PROGRAM_MEMORY_SIZE, expressionHeader.tokenBytes);
+        copyConstStringObjects(pParsedExpression);
+    }
+    pParsedExpressions = pNewBlock;
+}
+
+
+// ---------------------------------------------------------------------------------------------------
+// *   copy a parsed watch or condition expression kept for reuse to immediate mode program memory   *
+// ---------------------------------------------------------------------------------------------------
+
+// the program counter is set as if the expression was parsed just now. Returns a pointer to the next parsed expression
+
+char* Justina::restoreParsedExpression(char* pParsedExpression, parsingResult_type& parsingResult) {
+    ParsedExpressionHeader expressionHeader;
+    memcpy(&expressionHeader, pParsedExpression, sizeof(ParsedExpressionHeader));                   // not necessarily aligned: copy memory
+    pParsedExpression += sizeof(ParsedExpressionHeader);
+    parsingResult = (parsingResult_type)expressionHeader.parsingResult;
+
+    if (expressionHeader.tokenBytes > 0) {
+        memcpy(_programStorage + _PROGRAM_MEMORY_SIZE, pParsedExpression, expressionHeader.tokenBytes);
+        copyConstStringObjects(_programStorage + _PROGRAM_MEMORY_SIZE);                             // the copy gets its own string constants (deleted after execution)
+        _programCounter = _programStorage + _PROGRAM_MEMORY_SIZE + expressionHeader.tokenBytes - 1;
+    }
+    return pParsedExpression + expressionHeader.tokenBytes;
+}
+
+
 // -------------------------------------------------------------
 // *   check if all Justina functions referenced are defined   *
 // -------------------------------------------------------------
@@ -1577,6 +1793,118 @@ bool Justina::resetFunctionFlags() {
 }
 
 
+// ------------------------------------------------------------------------------------------
+// *   build the local variable init data of all Justina functions (program parsing done)   *
+// ------------------------------------------------------------------------------------------
+
+// parameter default values and local variable types, initializers and array dimensions only depend on the parsed program:
+// collect them once, so that a function call does not need to scan the function definition and local variable definitions each time
+// note: string initializers are not copied here (pointers to parsed string constants are stored) 
+
+void Justina::buildLocalVarInitData() {
+    deleteLocalVarInitData();
+    if (_localVarCount > 0) { _pLocalVarInitData = new LocalVarInitData[_localVarCount]{}; }
+
+    for (int index = 0; index < _justinaFunctionCount; index++) {
+        JustinaFunctionData& functionData = justinaFunctionData[index];
+        LocalVarInitData* pInitData = _pLocalVarInitData + (uint8_t)functionData.localVarNameRefs_startIndex;
+        int paramCount = functionData.paramOnlyCountInFunction;
+        int localVarCount = functionData.localVarCountInFunction;
+        int minArgCount = ((functionData.minMaxArgCounts) >> 4) & 0x0F;
+
+        int tokenType{}, terminalCode{};
+        char* pStep = functionData.pJustinaFunctionStartToken;
+
+
+        // parameters with default values (optional parameters: always scalars with a constant initializer)
+        // ------------------------------------------------------------------------------------------------
+
+        tokenType = jumpTokens(1, pStep);                                                                                   // opening parenthesis (after function name)
+        for (int count = 0; count < minArgCount; count++) { tokenType = findTokenStep(pStep, true, tok_isTerminalGroup1, termcod_comma); }
+
+        // skip variable and assignment (and preceding comma)
+        for (int count = minArgCount; count < paramCount; count++) {
+            tokenType = jumpTokens(((count == minArgCount) ? 3 : 4), pStep);
+
+            // now positioned at constant initializer
+            char valueType = ((*(char*)pStep) >> 4) & value_typeMask;
+            pInitData[count].valueType = valueType;                                                                         // long, float or string (no array)
+            if (valueType == value_isLong) { memcpy(&pInitData[count].initValue.longConst, ((Token_constant*)pStep)->cstValue.longConst, sizeof(long)); }
+            else if (valueType == value_isFloat) { memcpy(&pInitData[count].initValue.floatConst, ((Token_constant*)pStep)->cstValue.floatConst, sizeof(float)); }
+            else { memcpy(&pInitData[count].initValue.pStringConst, ((Token_constant*)pStep)->cstValue.pStringConst, sizeof(char*)); }     // copy the pointer, NOT the string
+        }
+
+        // skip (remainder of) function definition: execution of the function will start here
+        findTokenStep(pStep, true, tok_isTerminalGroup1, termcod_semicolon, termcod_semicolon_BPset, termcod_semicolon_BPallowed);
+        functionData.pFunctionBodyStartToken = pStep;
+
+
+        // local (non-parameter) variables
+        // -------------------------------
+
+        int count = paramCount;
+        while (count != localVarCount) {
+            findTokenStep(pStep, true, tok_isInternCommand, cmdcod_var, cmdcod_constVar);                                   // find local 'var' or 'const' keyword (always there)
+
+            do {
+                // no initializer: scalars and array elements are initialized as zero (float)
+                pInitData[count].valueType = value_isFloat;
+                pInitData[count].initValue.floatConst = 0.;
+
+                tokenType = jumpTokens(2, pStep, terminalCode);                                                             // either left parenthesis, assignment, comma or semicolon separator (always a terminal)
+
+                // array definition dimensions (checks done during parsing)
+                if (terminalCode == termcod_leftPar) {                                                                      // array opening parenthesis
+                    int dimCount = 0, arrayElements = 1;
+                    do {
+                        tokenType = jumpTokens(1, pStep);                                                                   // dimension
+                        char valueType = ((*(char*)pStep) >> 4) & value_typeMask;
+                        Val dimSubscript{};
+                        if (valueType == value_isLong) { memcpy(&dimSubscript, ((Token_constant*)pStep)->cstValue.longConst, sizeof(long)); }
+                        else { memcpy(&dimSubscript, ((Token_constant*)pStep)->cstValue.floatConst, sizeof(float)); dimSubscript.longConst = (long)dimSubscript.floatConst; }
+                        arrayElements *= dimSubscript.longConst;
+                        pInitData[count].arrayDimsAndCount[dimCount] = dimSubscript.longConst;
+                        dimCount++;
+
+                        tokenType = jumpTokens(1, pStep, terminalCode);                                                     // comma (dimension separator) or right parenthesis
+                    } while (terminalCode != termcod_rightPar);
+
+                    pInitData[count].arrayDimsAndCount[3] = dimCount;
+                    pInitData[count].arrayElements = arrayElements;
+                    pInitData[count].valueType |= var_isArray;
+
+                    tokenType = jumpTokens(1, pStep, terminalCode);                                                         // assignment, comma or semicolon
+                }
+
+                // initializer (if provided): an empty string is the only string allowed as array initializer (checked during parsing)
+                if (terminalCode == termcod_assign) {
+                    tokenType = jumpTokens(1, pStep);                                                                       // constant
+                    char valueType = ((*(char*)pStep) >> 4) & value_typeMask;
+                    pInitData[count].valueType = (pInitData[count].valueType & ~value_typeMask) | valueType;
+                    if (valueType == value_isLong) { memcpy(&pInitData[count].initValue.longConst, ((Token_constant*)pStep)->cstValue.longConst, sizeof(long)); }
+                    else if (valueType == value_isFloat) { memcpy(&pInitData[count].initValue.floatConst, ((Token_constant*)pStep)->cstValue.floatConst, sizeof(float)); }
+                    else { memcpy(&pInitData[count].initValue.pStringConst, ((Token_constant*)pStep)->cstValue.pStringConst, sizeof(char*)); }
+
+                    tokenType = jumpTokens(1, pStep, terminalCode);                                                         // comma or semicolon
+                }
+                count++;
+
+            } while (terminalCode == termcod_comma);
+        }
+    }
+}
+
+
+// ------------------------------------------------------------
+// *   delete the local variable init data of all functions   *
+// ------------------------------------------------------------
+
+void Justina::deleteLocalVarInitData() {
+    if (_pLocalVarInitData != nullptr) { delete[] _pLocalVarInitData; }
+    _pLocalVarInitData = nullptr;
+}
+
+
 // ----------------------------------------------------
 // *   set system (housekeeping) call back function   *
 // ----------------------------------------------------
@@ -1615,21 +1943,42 @@ void Justina::setRTCCallbackFunction(void (*func)(uint16_t* date, uint16_t* time
 // - while executing the Justina delay() function
 // - when a statement has been executed 
 // the callback function relays specific flags to the caller and upon return, reads certain flags set by the caller 
+// the clock is not read at every call: the number of calls between clock readings is adapted to read the clock about every CLOCK_SAMPLE_INTERVAL ms...
+// ...(within limits), so that callbacks (and stop, abort and kill requests relayed by them) are delayed by a bounded amount of time only  
+// the number of calls is increased gradually, but it is reset to 1 as soon as a clock sample shows that calls take longer than expected
+// yield() is only called when the clock is read as well: about every CLOCK_SAMPLE_INTERVAL ms, and after at most MAX_CALLS_PER_CLOCK_SAMPLE calls if calls get...
+// ...slow suddenly. That is frequent enough for background tasks (e.g. ESP32 WiFi stack and task watchdog) and saves the cost of a yield() call per statement
 
 void Justina::execPeriodicHousekeeping(bool* pKillNow, bool* pForcedAbort, bool* pSetStdConsole) {
     if (pKillNow != nullptr) { *pKillNow = false; }; if (pForcedAbort != nullptr) { *pForcedAbort = false; }    // init
+    if (--_callsToClockSample > 0) { return; }                                                                  // not yet time to read the clock
+
+    _previousTime = _currenttime;
+    _currenttime = millis();
+    unsigned long sinceLastSample = _currenttime - _previousTime;                                               // note: unsigned arithmetic also handles millis() overflow after about 47 days
+    if ((sinceLastSample < CLOCK_SAMPLE_INTERVAL / 2) && (_callsPerClockSample < MAX_CALLS_PER_CLOCK_SAMPLE)) { _callsPerClockSample *= 2; }
+    else if (sinceLastSample > CLOCK_SAMPLE_INTERVAL) { _callsPerClockSample = 1; }                              // calls got slow (after an idle period): read the clock at every call again
+    if (_callsPerClockSample > MAX_CALLS_PER_CLOCK_SAMPLE) { _callsPerClockSample = MAX_CALLS_PER_CLOCK_SAMPLE; }
+    _callsToClockSample = _callsPerClockSample;
+
     if (_housekeepingCallback != nullptr) {
-        _currenttime = millis();
-        _previousTime = _currenttime;
-        // note: also handles millis() overflow after about 47 days
-        if ((_lastCallBackTime + CALLBACK_INTERVAL < _currenttime) || (_currenttime < _previousTime)) {         // while executing, limit calls to housekeeping callback routine 
+        if (_currenttime - _lastCallBackTime > CALLBACK_INTERVAL) {                                             // while executing, limit calls to housekeeping callback routine 
+            unsigned long previousCallBackTime = _lastCallBackTime;
             _lastCallBackTime = _currenttime;
+            if (_tracingOn) { traceEvent(trace_callback, 'B', 0); }
             _housekeepingCallback(_appFlags);                                                                   // execute housekeeping callback
+            if (_tracingOn) { traceEvent(trace_callback, 'E', 0); }
             if ((_appFlags & appFlag_consoleRequestBit) && (pSetStdConsole != nullptr)) { *pSetStdConsole = true; }
             if ((_appFlags & appFlag_killRequestBit) && (pKillNow != nullptr)) { *pKillNow = true; }
-            if (_appFlags & appFlag_stopRequestBit) { _appFlagStopRequestIsStored = true; }
+            if (_appFlags & appFlag_stopRequestBit) { _appFlagStopRequestIsStored = true; _debugMachineryArmed = true; }
             if ((_appFlags & appFlag_abortRequestBit) && (pForcedAbort != nullptr)) { *pForcedAbort = true; }
 
+            // stop, abort or kill request: the request could have been made right after the previous callback
+            if ((_appFlags & (appFlag_stopRequestBit | appFlag_abortRequestBit | appFlag_killRequestBit)) && !_stopRequestPending) {
+                _stopRequestPending = true;
+                _stopRequestWindowStart = previousCallBackTime;
+            }
+
             _appFlags &= ~appFlag_dataInOut;                                                                    // reset flag
         }
     }
@@ -1638,6 +1987,18 @@ void Justina::execPeriodicHousekeeping(bool* pKillNow, bool* pForcedAbort, bool*
 }
 
 
+// ------------------------------------------------------------------------------------
+// *   a stop, abort or kill request was honoured: maintain worst-case stop latency   *
+// ------------------------------------------------------------------------------------
+
+void Justina::stopRequestHonoured() {
+    if (!_stopRequestPending) { return; }                                                                       // stop for another reason (breakpoint, ...)
+    _stopRequestPending = false;
+    unsigned long latency = millis() - _stopRequestWindowStart;
+    if (latency > _maxStopLatency) { _maxStopLatency = latency; }
+}
+
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // *   sets pointers to the locations where the Arduino program stored information about user-defined (external) cpp functions and commands (user callback functions)   *
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1707,6 +2068,14 @@ void Justina::resetMachine(bool withUserVariables, bool withBreakpoints, bool ke
     deleteIdentifierNameObjects(programVarNames, _programVarNameCount);
     deleteIdentifierNameObjects(JustinaFunctionNames, _justinaFunctionCount);
     if (withUserVariables) { deleteIdentifierNameObjects(userVarNames, _userVarCount, true); }
+    resetIdentNameArena(_programNameArena);                                                         // program variable and Justina function names: delete all at once
+    if (withUserVariables) { resetIdentNameArena(_userVarNameArena); }
+    deleteLocalVarInitData();                                                                       // local variable init data of Justina functions
+    clearEvalCache();                                                                               // parsed eval() strings refer to program and user variables, and functions
+    clearBatchLineCaches();                                                                         // parsed batch file lines as well
+    deleteAllParsedDebugExpressions();                                                              // parsed watch and breakpoint condition strings as well
+    clearProfile();                                                                                 // profiler counters refer to program statements and Justina functions
+    clearTrace();                                                                                   // trace events refer to Justina functions
 
     // delete variable heap objects: array variable element string objects
     deleteStringArrayVarsStringObjects(globalVarValues, globalVarType, _programVarNameCount, 0, true);
@@ -1714,6 +2083,8 @@ void Justina::resetMachine(bool withUserVariables, bool withBreakpoints, bool ke
     if (withUserVariables) {
         deleteStringArrayVarsStringObjects(userVarValues, userVarType, _userVarCount, 0, false, true);
         deleteLastValueFiFoStringObjects();
+        for (int i = 0; i < MAX_STRING_BUFFERS; i++) { deleteStringBuffer(_stringBuffers + i); }   // string buffers live as long as user variables
+        deleteBatchLabelIndexes();                                                                  // label indexes of batch files as well (rebuilt when needed)
     }
 
     // delete variable heap objects: scalar variable strings and array variable array storage 
@@ -1735,6 +2106,7 @@ void Justina::resetMachine(bool withUserVariables, bool withBreakpoints, bool ke
 
     clearParsedCommandLineStack(deleteImmModeCmdStackLevels);                                                   // including parsed string constants
     deleteConstStringObjects(_programStorage);
+    deleteStringConstPool();                                                                                    // string literals in the parsed program: delete all at once
     deleteConstStringObjects(_programStorage + _PROGRAM_MEMORY_SIZE);
 
     // clear expression evaluation stack
@@ -1743,6 +2115,10 @@ void Justina::resetMachine(bool withUserVariables, bool withBreakpoints, bool ke
     // delete parsing stack (keeps track of open parentheses and open command blocks during parsing)
     parsingStack.deleteList();
 
+    // return recyclable (free) flow control stack and parsed statement line stack levels to the heap
+    flowCtrlStack.releasePool();
+    parsedStatementLineStack.releasePool();
+
     // delete watch string and delete breakpoint watch and condition strings ?
     if (withBreakpoints) {
         if (_pwatchString != nullptr) {        // internal watch 'variable'
@@ -1762,6 +2138,7 @@ void Justina::resetMachine(bool withUserVariables, bool withBreakpoints, bool ke
     else {
         bool wasDraft = _pBreakpoints->_breakpointsStatusDraft;
         _pBreakpoints->_breakpointsStatusDraft = (_pBreakpoints->_breakpointsUsed > 0);                         // '_breakpointsStatusDraft' set according to existence of entries in breakpoint table
+        _pBreakpoints->rebuildBPstepHashIndex();                                                                // program steps are not valid any more
         _pBreakpoints->_BPlineRangeStorageUsed = 0;
     }
 
@@ -1897,6 +2274,9 @@ void Justina::initInterpreterVariables(bool fullReset, bool keepDebugLevelBatchF
 
     _programVarNameCount = 0;
     if (fullReset) { _userVarCount = 0; }
+    rebuildIdentHashIndex(programVarNames, 0);                                      // clear identifier name hash indexes
+    rebuildIdentHashIndex(JustinaFunctionNames, 0);
+    if (fullReset) { rebuildIdentHashIndex(userVarNames, 0); }
     else {
         int index = 0;                                                              // clear user variable flag 'variable is used by program'
         while (index++ < _userVarCount) { userVarType[index] = userVarType[index] & ~var_userVarUsedByProgram; }
@@ -1917,6 +2297,7 @@ void Justina::initInterpreterVariables(bool fullReset, bool keepDebugLevelBatchF
     }
 
     _localVarValueAreaCount = 0;
+    _frameStackTop = 0;                                                             // frame stack: no local variable storage in use
     _localVarStringObjectCount = 0;
     _localArrayObjectCount = 0;
 
@@ -2046,10 +2427,10 @@ void Justina::deleteIdentifierNameObjects(char** pIdentNameArray, int identifier
         _pDebugOut->print(isUserVar ? "\r\n----- (usrvar name) " : "\r\n----- (ident name ) "); _pDebugOut->println((uint32_t) * (pIdentNameArray + index), HEX);
         _pDebugOut->print("       delete ident "); _pDebugOut->println(*(pIdentNameArray + index));
     #endif
-        isUserVar ? _userVarNameStringObjectCount-- : _identifierNameStringObjectCount--;
-        delete[] * (pIdentNameArray + index);
+        isUserVar ? _userVarNameStringObjectCount-- : _identifierNameStringObjectCount--;        // names are deleted all at once (identifier name arena is reset)
         index++;
     }
+    rebuildIdentHashIndex(pIdentNameArray, 0);                              // clear identifier name hash index
 }
 
 
@@ -2167,11 +2548,15 @@ void Justina::deleteConstStringObjects(char* pFirstToken) {
     char* pAnum;
     TokenPointer prgmCnt;
 
+    // string literals in the parsed program are stored in the string constant pool (see deleteStringConstPool()): only generic names are separate objects
+    bool isProgramMemory = (pFirstToken >= _programStorage) && (pFirstToken < _programStorage + _PROGRAM_MEMORY_SIZE);
+
     prgmCnt.pTokenChars = pFirstToken;
     uint8_t tokenType = *prgmCnt.pTokenChars & 0x0F;
     while (tokenType != tok_no_token) {                                                                 // for all tokens in token list
         // not for predefined symbolic constants
         bool isStringConst = (tokenType == tok_isConstant) ? (((*prgmCnt.pTokenChars >> 4) & value_typeMask) == value_isStringPointer) : false;
+        if (isProgramMemory) { isStringConst = false; }
 
         if (isStringConst || (tokenType == tok_isGenericName)) {
             memcpy(&pAnum, prgmCnt.pCstToken->cstValue.pStringConst, sizeof(pAnum));                    // copy pointer (not necessarily aligned with word size: copy memory instead)
@@ -2184,14 +2569,118 @@ void Justina::deleteConstStringObjects(char* pFirstToken) {
                 delete[] pAnum;
             }
         }
-        uint8_t tokenLength = (tokenType >= tok_isTerminalGroup1) ? sizeof(Token_terminal) : (tokenType == tok_isConstant) ? sizeof(Token_constant) :
-            (tokenType == tok_isSymbolicConstant) ? sizeof(Token_symbolicConstant) : (*prgmCnt.pTokenChars >> 4) & 0x0F;
+        uint8_t tokenLength = (_tokenDecodeTable[(uint8_t)*prgmCnt.pTokenChars] >> 8) & 0x0F;
         prgmCnt.pTokenChars += tokenLength;
         tokenType = *prgmCnt.pTokenChars & 0x0F;
     }
 }
 
 
+// -----------------------------------------------------------------------------------------------------
+// *   replace all parsed string constants in a token list by a copy (the originals are not deleted)   *
+// -----------------------------------------------------------------------------------------------------
+
+// used to copy parsed statements to and from the eval() cache: each copy of the parsed statements owns its string constants 
+
+void Justina::copyConstStringObjects(char* pFirstToken) {
+    char* pAnum;
+    TokenPointer prgmCnt;
+
+    prgmCnt.pTokenChars = pFirstToken;
+    uint8_t tokenType = *prgmCnt.pTokenChars & 0x0F;
+    while (tokenType != tok_no_token) {                                                                 // for all tokens in token list
+        bool isStringConst = (tokenType == tok_isConstant) ? (((*prgmCnt.pTokenChars >> 4) & value_typeMask) == value_isStringPointer) : false;
+
+        if (isStringConst) {
+            memcpy(&pAnum, prgmCnt.pCstToken->cstValue.pStringConst, sizeof(pAnum));                    // copy pointer (not necessarily aligned with word size: copy memory instead)
+            if (pAnum != nullptr) {
+                _parsedStringConstObjectCount++;
+                char* pCopy = new char[strlen(pAnum) + 1];
+                strcpy(pCopy, pAnum);
+            #if PRINT_HEAP_OBJ_CREA_DEL
+                _pDebugOut->print("\r\n+++++ (parsed str ) ");   _pDebugOut->println((uint32_t)pCopy, HEX);
+                _pDebugOut->print("  copy const.string ");   _pDebugOut->println(pCopy);
+            #endif
+                memcpy(prgmCnt.pCstToken->cstValue.pStringConst, &pCopy, sizeof(pCopy));
+            }
+        }
+        uint8_t tokenLength = (_tokenDecodeTable[(uint8_t)*prgmCnt.pTokenChars] >> 8) & 0x0F;
+        prgmCnt.pTokenChars += tokenLength;
+        tokenType = *prgmCnt.pTokenChars & 0x0F;
+    }
+}
+
+
+// -------------------------------------------------------------------------------
+// *   clear the eval() cache: delete all parsed eval() strings kept for reuse   *
+// -------------------------------------------------------------------------------
+
+void Justina::clearEvalCache() {
+    for (int i = 0; i < MAX_EVAL_CACHE_ENTRIES; i++) { deleteEvalCacheEntry(_pEvalCache[i]); }
+}
+
+
+// ------------------------------------------------
+// *   delete an eval() cache entry (if in use)   *
+// ------------------------------------------------
+
+void Justina::deleteEvalCacheEntry(EvalCacheEntry& entry) {
+    if (entry.pEvalString == nullptr) { return; }                                                       // entry not in use
+
+    deleteConstStringObjects(entry.pParsedStatements);                                                  // string constants owned by the cached parsed statements
+#if PRINT_HEAP_OBJ_CREA_DEL
+    _pDebugOut->print("\r\n----- (system str ) "); _pDebugOut->println((uint32_t)entry.pEvalString, HEX);
+    _pDebugOut->print("  del eval cache str "); _pDebugOut->println(entry.pEvalString);
+#endif
+    _systemStringObjectCount -= 2;                                                                      // eval() string and parsed statements
+    delete[] entry.pEvalString;
+    delete[] entry.pParsedStatements;
+    entry.pEvalString = nullptr;
+    entry.pParsedStatements = nullptr;
+}
+
+
+// -----------------------------------------------------------------------------------------------
+// *   delete parsed watch or breakpoint condition expressions kept for reuse (if not nullptr)   *
+// -----------------------------------------------------------------------------------------------
+
+void Justina::deleteParsedExpressions(char*& pParsedExpressions) {
+    if (pParsedExpressions == nullptr) { return; }
+
+    int blockSize = ((ParsedExpressionsHeader*)pParsedExpressions)->blockSize;
+    char* pParsedExpression = pParsedExpressions + sizeof(ParsedExpressionsHeader);
+    while (pParsedExpression < pParsedExpressions + blockSize) {
+        ParsedExpressionHeader expressionHeader;
+        memcpy(&expressionHeader, pParsedExpression, sizeof(ParsedExpressionHeader));               // not necessarily aligned: copy memory
+        pParsedExpression += sizeof(ParsedExpressionHeader);
+        if (expressionHeader.tokenBytes > 0) { deleteConstStringObjects(pParsedExpression); }      // string constants owned by the parsed expression
+        pParsedExpression += expressionHeader.tokenBytes;
+    }
+
+#if PRINT_HEAP_OBJ_CREA_DEL
+    _pDebugOut->print("\r\n----- (system str ) "); _pDebugOut->println((uint32_t)pParsedExpressions, HEX);
+#endif
+    _systemStringObjectCount--;
+    delete[] pParsedExpressions;
+    pParsedExpressions = nullptr;
+}
+
+
+// ---------------------------------------------------------------------------------------------
+// *   delete all parsed watch and breakpoint watch and condition expressions kept for reuse   *
+// ---------------------------------------------------------------------------------------------
+
+// parsed expressions refer to variables by index: to be called whenever variables are created or deleted
+
+void Justina::deleteAllParsedDebugExpressions() {
+    deleteParsedExpressions(_pParsedWatchString);
+    for (int i = 0; i < _pBreakpoints->_breakpointsUsed; i++) {
+        deleteParsedExpressions(_pBreakpoints->_pBreakpointData[i].pParsedWatch);
+        deleteParsedExpressions(_pBreakpoints->_pBreakpointData[i].pParsedCondition);
+    }
+}
+
+
 // ---------------------------------------------------------------------------------
 // *   delete a variable string object referenced in an evaluation stack element   *
 // ---------------------------------------------------------------------------------
@@ -2239,3 +2728,21 @@ Justina::execResult_type Justina::deleteIntermStringObject(LE_evalStack* pStackL
 }
 
 
+// ------------------------------------------------------------------------------------------------------------
+// *   take over the intermediate string object referenced in an evaluation stack element (no copy needed)   *
+// ------------------------------------------------------------------------------------------------------------
+
+// returns nullptr if not an intermediate string object (or an empty string). Otherwise, the stack element does not reference the string object any more...
+// ...(it will not be deleted together with the stack element) and the caller is responsible for moving the object count to its own object category
+
+char* Justina::takeIntermStringObject(LE_evalStack* pStackLvl) {
+
+    if ((pStackLvl->varOrConst.valueAttributes & constIsIntermediate) != constIsIntermediate) { return nullptr; }                   // not an intermediate constant
+    if (pStackLvl->varOrConst.valueType != value_isStringPointer) { return nullptr; }                                               // not a string object
+
+    char* pString = pStackLvl->varOrConst.value.pStringConst;
+    pStackLvl->varOrConst.value.pStringConst = nullptr;                                                                             // (empty string)
+    return pString;
+}
+
+
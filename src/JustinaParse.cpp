@@ -98,6 +98,8 @@ Justina::parsingResult_type Justina::parseStatement(char*& pInputStart, char*& p
             _isClearAllCmd = false;
 
             _userVarUnderConstruction = false;
+            _statementStartStep = _programCounter - _programStorage;                                                // first token of the statement (constant folding)
+            _statementHasJumpTokens = false;
         }
         // determine token group of last token parsed (bits b4 to b0): this defines which tokens are allowed as next token
         _lastTokenGroup_sequenceCheck_bit = isOperator ? lastTokenGroup_0 :
@@ -114,7 +116,10 @@ Justina::parsingResult_type Justina::parseStatement(char*& pInputStart, char*& p
 
         // move to the first non-space character of next token 
         while (pNext[0] == ' ') { pNext++; }                                                                        // skip leading spaces
-        if (pNext[0] == '\0') { pNextParseStatement = pNext; break; }                                               // end of statement: prepare to quit parsing  
+        if (pNext[0] == '\0') {                                                                                     // end of statement: prepare to quit parsing  
+            if (_statementHasJumpTokens) { resolveJumpOffsets(); }                                                  // final statement without ending semicolon: store jump offsets as well
+            pNextParseStatement = pNext; break;
+        }
 
         // watch, BP watch or BP condition string ? parse one statement at a time, then execute it first (note: within BP condition strings, only the first expression will be parsed and executed)
         if ((_parsingExecutingWatchString || _parsingExecutingConditionString) && isSemicolon) { pNextParseStatement = pNext;  break; }
@@ -481,9 +486,8 @@ bool Justina::parseAsInternCommand(char*& pNext, parsingResult_type& result) {
     if (!isalpha(pNext[0])) { return true; }                                                                    // first character is not a letter ? Then it's not a keyword (it can still be something else)
     while (isalnum(pNext[0]) || (pNext[0] == '_')) { pNext++; }                                                 // do until first character after alphanumeric token (can be anything, including '\0')
 
-    for (commandIndex = _internCommandCount - 1; commandIndex >= 0; commandIndex--) {                           // for all defined keywords: check against alphanumeric token (NOT ending by '\0')
-        if (strlen(_internCommands[commandIndex]._commandName) != pNext - pch) { continue; }                    // token has correct length ? If not, skip remainder of loop ('continue')                            
-        if (strncmp(_internCommands[commandIndex]._commandName, pch, pNext - pch) != 0) { continue; }           // token corresponds to keyword ? If not, skip remainder of loop ('continue') 
+    commandIndex = findInternCommand(pch, pNext - pch);                                                         // check alphanumeric token (NOT ending by '\0') against keywords
+    if (commandIndex >= 0) {                                                                                    // token corresponds to keyword
 
         // commands (starting with a keyword) are not allowed within watch, BP watch, BP condition strings and in eval() strings.
         // if not allowed, reset pointer to first character to parse, indicate error and return
@@ -545,6 +549,100 @@ bool Justina::parseAsInternCommand(char*& pNext, parsingResult_type& result) {
 }
 
 
+// -----------------------------------------------------------------------------------------------------
+// *   build parser lookup indexes for internal commands, internal cpp functions and terminal tokens   *
+// -----------------------------------------------------------------------------------------------------
+
+// the command, function and terminal tables are constant: the indexes are built once, by the constructor
+
+void Justina::buildParserLookupIndexes() {
+
+    // internal commands and internal cpp functions: index in alphabetical order of names (insertion sort)
+    for (int i = 0; i < _internCommandCount; i++) {
+        int j = i;
+        while ((j > 0) && (strcmp(_internCommands[_internCommandSortIndex[j - 1]]._commandName, _internCommands[i]._commandName) > 0)) { _internCommandSortIndex[j] = _internCommandSortIndex[j - 1]; j--; }
+        _internCommandSortIndex[j] = i;
+    }
+    for (int i = 0; i < _internCppFunctionCount; i++) {
+        int j = i;
+        while ((j > 0) && (strcmp(_internCppFunctions[_internCppFunctionSortIndex[j - 1]].funcName, _internCppFunctions[i].funcName) > 0)) { _internCppFunctionSortIndex[j] = _internCppFunctionSortIndex[j - 1]; j--; }
+        _internCppFunctionSortIndex[j] = i;
+    }
+
+    // terminals: chain terminals with the same first character, starting with the highest terminal index
+    for (int c = 0; c < 0x80 - ' '; c++) { _terminalFirstCharIndex[c] = -1; }
+    for (int i = 0; i < _termTokenCount; i++) {                                                                 // each terminal becomes the first one in its chain
+        int c = _terminals[i].terminalName[0] - ' ';
+        _terminalNextIndex[i] = _terminalFirstCharIndex[c];
+        _terminalFirstCharIndex[c] = i;
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------
+// *   find an internal command: binary search; return command index (-1 if not found)   *
+// ---------------------------------------------------------------------------------------
+
+// the name to find is NOT '\0' terminated
+
+int Justina::findInternCommand(char* pch, int nameLength) {
+    int low{ 0 }, high{ _internCommandCount - 1 };
+    while (low <= high) {
+        int middle = (low + high) / 2;
+        const char* pName = _internCommands[_internCommandSortIndex[middle]]._commandName;
+        int compare = strncmp(pName, pch, nameLength);
+        if (compare == 0) {
+            if (pName[nameLength] == '\0') { return _internCommandSortIndex[middle]; }                         // match
+            compare = 1;                                                                                        // command name is longer: comes after name to find
+        }
+        if (compare < 0) { low = middle + 1; }
+        else { high = middle - 1; }
+    }
+    return -1;
+}
+
+
+// ---------------------------------------------------------------------------------------------
+// *   find an internal cpp function: binary search; return function index (-1 if not found)   *
+// ---------------------------------------------------------------------------------------------
+
+// the name to find is NOT '\0' terminated
+
+int Justina::findInternCppFunction(char* pch, int nameLength) {
+    int low{ 0 }, high{ _internCppFunctionCount - 1 };
+    while (low <= high) {
+        int middle = (low + high) / 2;
+        const char* pName = _internCppFunctions[_internCppFunctionSortIndex[middle]].funcName;
+        int compare = strncmp(pName, pch, nameLength);
+        if (compare == 0) {
+            if (pName[nameLength] == '\0') { return _internCppFunctionSortIndex[middle]; }                     // match
+            compare = 1;                                                                                        // function name is longer: comes after name to find
+        }
+        if (compare < 0) { low = middle + 1; }
+        else { high = middle - 1; }
+    }
+    return -1;
+}
+
+
+// ----------------------------------------------------------------------------------------------------------------------
+// *   find the terminal token the characters to parse start with; return terminal index (-1 if not a terminal token)   *
+// ----------------------------------------------------------------------------------------------------------------------
+
+// only terminals starting with the same character are checked, starting at the end of the _terminals array (because of the ordering of names in the array)
+// do not look for trailing space, to use strncmp() with number of non-space characters found, because a space is not required after an operator
+
+int Justina::findTerminal(char* pch) {
+    uint8_t c = (uint8_t)pch[0];
+    if ((c < ' ') || (c >= 0x80)) { return -1; }                                                                // not a printable ASCII character (including '\0')
+
+    for (int termIndex = _terminalFirstCharIndex[c - ' ']; termIndex >= 0; termIndex = _terminalNextIndex[termIndex]) {
+        if (strncmp(_terminals[termIndex].terminalName, pch, strlen(_terminals[termIndex].terminalName)) == 0) { return termIndex; }
+    }
+    return -1;
+}
+
+
 // -----------------------------------------------------------------------------------------------------
 // *   try to parse next characters as an external (user cpp) command (start of a command statement)   *
 // -----------------------------------------------------------------------------------------------------
@@ -761,7 +859,8 @@ bool Justina::parseAsStringConstant(char*& pNext, parsingResult_type& result) {
     } while (false);
 
     if (result != result_tokenNotFound) {
-        if (predefinedConstIndex == -1) {                       // an ordinary (not a symbolic) parsed string constant ? delete the string object
+        // an ordinary (not a symbolic) parsed string constant, not in the string constant pool (deleted with the program) ? delete the string object
+        if ((predefinedConstIndex == -1) && (pStringCst != nullptr) && !isPooledStringConst(pStringCst)) {
         #if PRINT_HEAP_OBJ_CREA_DEL
             _pDebugOut->print("\r\n----- (parsed str ) ");   _pDebugOut->println((uint32_t)pStringCst, HEX);
             _pDebugOut->print("  parse str cst (1) ");   _pDebugOut->println(pStringCst);
@@ -802,7 +901,8 @@ bool Justina::parseAsStringConstant(char*& pNext, parsingResult_type& result) {
     }
 
     if (result == result_arrayDef_emptyInitStringExpected) {
-        if (predefinedConstIndex == -1) {                       // an ordinary (not a symbolic) parsed string constant ? delete the string object
+        // an ordinary (not a symbolic) parsed string constant, not in the string constant pool (deleted with the program) ? delete the string object
+        if ((predefinedConstIndex == -1) && (pStringCst != nullptr) && !isPooledStringConst(pStringCst)) {
         #if PRINT_HEAP_OBJ_CREA_DEL
             _pDebugOut->print("\r\n----- (parsed str ) ");   _pDebugOut->println((uint32_t)pStringCst, HEX);
             _pDebugOut->print("  parse str cst (2) ");   _pDebugOut->println(pStringCst);
@@ -844,27 +944,20 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
     char* pch = pNext;                                                                                          // pointer to first character to parse (any spaces have been skipped already)
     int termIndex{};
 
-    // for all defined terminal symbolic names: check against alphanumeric token. Search, starting at the end (because of the ordering of names in the _terminals array)
-    for (termIndex = _termTokenCount - 1; termIndex >= 0; termIndex--) {
-        int len = strlen(_terminals[termIndex].terminalName);                                                   // token has correct length ? If not, skip remainder of loop ('continue')                            
-        // do not look for trailing space, to use strncmp() with number of non-space characters found, because a space is not required after an operator
-        if (strncmp(_terminals[termIndex].terminalName, pch, len) == 0) { break; }                              // token corresponds to terminal name ? Then exit loop    
-    }
+    // check terminal symbolic names against token (only terminal names starting with the same character)
+    termIndex = findTerminal(pch);
     if (termIndex < 0) { return true; }                                                                         // token is not a one-character token (and it's not a two-char token, because these start with same character)
     pNext += strlen(_terminals[termIndex].terminalName);                                                        // move to first character after terminal name
 
     int nextTermIndex;  // peek: is next token a terminal ? nextTermIndex will be -1 if not
     char* peek = pNext;     // first character of next token (or '\0')
     while (peek[0] == ' ') { peek++; }
-    for (nextTermIndex = _termTokenCount - 1; nextTermIndex >= 0; nextTermIndex--) {                            // for all defined terminal symbolic names: check against alphanumeric token (NOT ending by '\0')
-        int len = strlen(_terminals[nextTermIndex].terminalName);                                               // token has correct length ? If not, skip remainder of loop ('continue')                            
-        // do not look for trailing space, to use strncmp() with number of non-space characters found, because a space is not required after an operator
-        if (strncmp(_terminals[nextTermIndex].terminalName, peek, len) == 0) { break; }                         // token corresponds to terminal name ? Then exit loop   
-    }
+    nextTermIndex = findTerminal(peek);
 
 
     tokenType_type tokenType;
     uint8_t flags{ B0 }, flags2{ B0 };
+    bool isLazyArgSeparator{ false };                                                                           // argument separator of a lazy function (ifte, switch, choose) ?
 
     switch (_terminals[termIndex].terminalCode) {
 
@@ -1010,7 +1103,7 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
 
                     int funcIndex = _pParsingStack->openPar.identifierIndex;                                                // note: also stored in stack for FUNCTION definition block level; here we can pick one of both
                     // if previous calls, check if range of actual argument counts that occurred in previous calls corresponds to mandatory and optional arguments defined now
-                    bool previousCalls = (JustinaFunctionNames[funcIndex][MAX_IDENT_NAME_LEN + 1]) != c_JustinaFunctionFirstOccurFlag;
+                    bool previousCalls = (justinaFunctionData[funcIndex].minMaxArgCounts) != c_JustinaFunctionFirstOccurFlag;
                     if (previousCalls) {                                                                                    // stack contains current range of actual args occurred in previous calls
                         if (((int)_pParsingStack->openPar.minArgs < justinaFunctionDef_minArgCounter) ||
                             (int)_pParsingStack->openPar.maxArgs > justinaFunctionDef_maxArgCounter) {
@@ -1020,7 +1113,7 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
 
                     // store min required & max allowed n� of arguments in identifier storage
                     // this replaces the range of actual argument counts that occurred in previous calls (if any)
-                    JustinaFunctionNames[funcIndex][MAX_IDENT_NAME_LEN + 1] = (justinaFunctionDef_minArgCounter << 4) | (justinaFunctionDef_maxArgCounter);
+                    justinaFunctionData[funcIndex].minMaxArgCounts = (justinaFunctionDef_minArgCounter << 4) | (justinaFunctionDef_maxArgCounter);
 
                     // check that order of arrays and scalar variables is consistent with previous calls and function definition
                     if (!checkJustinaFuncArgArrayPattern(result, true)) { pNext = pch; return false; };                     // verify that the order of scalar and array parameters is consistent with arguments
@@ -1054,7 +1147,9 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
                 if (!arrayWithAssignmentOp && !arrayWithoutInitializer) {
                     if (isUserVar) {
                         // consider user variable not created (relevant for user variables only, because program variables are destroyed anyway if parsing fails)
+                        removeUserVarName(_userVarCount - 1);
                         _userVarCount--;
+                        rebuildIdentHashIndex(userVarNames, _userVarCount);
                         _userVarUnderConstruction = false;
                     }
                     pNext = pch; result = result_assignmentOrSeparatorExpected; return false;
@@ -1119,10 +1214,10 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
                     // if at least one previous call (maybe a nested call) is completely parsed, retrieve current range of actual args that occurred in these previous calls
                     // and update this range with the argument count of the current Justina function call that is at its closing parenthesis
                     int funcIndex = _pParsingStack->openPar.identifierIndex;                                                // of current function call: stored in stack for current PARENTHESIS level
-                    bool prevJusinaFuncCompletelyParsed = (JustinaFunctionNames[funcIndex][MAX_IDENT_NAME_LEN + 1]) != c_JustinaFunctionFirstOccurFlag;
+                    bool prevJusinaFuncCompletelyParsed = (justinaFunctionData[funcIndex].minMaxArgCounts) != c_JustinaFunctionFirstOccurFlag;
                     if (prevJusinaFuncCompletelyParsed) {
-                        _pParsingStack->openPar.minArgs = ((JustinaFunctionNames[funcIndex][MAX_IDENT_NAME_LEN + 1]) >> 4) & 0x0F;
-                        _pParsingStack->openPar.maxArgs = (JustinaFunctionNames[funcIndex][MAX_IDENT_NAME_LEN + 1]) & 0x0F;
+                        _pParsingStack->openPar.minArgs = ((justinaFunctionData[funcIndex].minMaxArgCounts) >> 4) & 0x0F;
+                        _pParsingStack->openPar.maxArgs = (justinaFunctionData[funcIndex].minMaxArgCounts) & 0x0F;
                         if ((int)_pParsingStack->openPar.minArgs > actualArgs) { _pParsingStack->openPar.minArgs = actualArgs; }
                         if ((int)_pParsingStack->openPar.maxArgs < actualArgs) { _pParsingStack->openPar.maxArgs = actualArgs; }
                     }
@@ -1130,7 +1225,7 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
                     else { _pParsingStack->openPar.minArgs = actualArgs; _pParsingStack->openPar.maxArgs = actualArgs; }
 
                     // store the up to date range of actual argument counts in identifier storage
-                    JustinaFunctionNames[funcIndex][MAX_IDENT_NAME_LEN + 1] = (_pParsingStack->openPar.minArgs << 4) | (_pParsingStack->openPar.maxArgs);
+                    justinaFunctionData[funcIndex].minMaxArgCounts = (_pParsingStack->openPar.minArgs << 4) | (_pParsingStack->openPar.maxArgs);
                 }
 
                 // if call to previously defined Justina function, to an internal or external cpp function, or if open parenthesis, then check argument count 
@@ -1296,6 +1391,13 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
                 if (flags & internCppFunctionBit) { if (!checkInternCppFuncArgArrayPattern(result)) { pNext = pch; return false; }; }
                 if (flags & externCppFunctionBit) { if (!checkExternCppFuncArgIsScalar(result)) { pNext = pch; return false; }; }
                 else if (flags & JustinaFunctionBit) { if (!checkJustinaFuncArgArrayPattern(result, false)) { pNext = pch; return false; }; }
+
+                // lazy function: during execution, arguments not needed to produce the function result will be skipped
+                if (flags & internCppFunctionBit) {
+                    int funcIndex = _pParsingStack->openPar.identifierIndex;
+                    char functionCode = _internCppFunctions[funcIndex].functionCode;
+                    isLazyArgSeparator = ((functionCode == fnccod_ifte) || (functionCode == fnccod_switch) || (functionCode == fnccod_choose));
+                }
             }
 
 
@@ -1484,6 +1586,18 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
         }
     }
 
+    // constant folding: the expression preceding a right parenthesis, comma or semicolon is complete (not in variable declarations and function definitions)
+    // ----------------------------------------------------------------------------------------------------------------------------------------------------
+
+    if (!_isAnyVarCmd && !_isJustinaFunctionCmd) {
+        int terminalCode = _terminals[termIndex].terminalCode;
+        if (terminalCode == termcod_rightPar) { foldConstantExpression(_parenthesisLevel + 1); }                // parenthesis level was decremented already
+        else if ((terminalCode == termcod_comma) || (terminalCode == termcod_semicolon)) { foldConstantExpression(_parenthesisLevel); }
+    }
+
+    // short-circuit evaluation: the statement is complete and its tokens will not move any more: store the jump offsets of its jump tokens
+    if ((_terminals[termIndex].terminalCode == termcod_semicolon) && _statementHasJumpTokens) { resolveJumpOffsets(); }
+
     // create token
     // ------------
 
@@ -1491,8 +1605,16 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
     tokenType = (termIndex <= 0x0F) ? tok_isTerminalGroup1 : (termIndex <= 0x1F) ? tok_isTerminalGroup2 : tok_isTerminalGroup3;
     _tokenIndex = termIndex;
 
+    // jump tokens ('&&' and '||' operators, lazy function argument separators) include a jump offset: stored when the statement is complete
+    bool isJumpToken = isLazyArgSeparator || (_terminals[termIndex].terminalCode == termcod_and) || (_terminals[termIndex].terminalCode == termcod_or);
+
     Token_terminal* pToken = (Token_terminal*)_programCounter;
     pToken->tokenTypeAndIndex = tokenType | ((termIndex & 0x0F) << 4);                                  // terminal tokens only: token type character includes token index too 
+    if (isLazyArgSeparator) { pToken->tokenTypeAndIndex = _commaLazyArg_token; }                         // parsed as a comma, but stored as a lazy function argument separator
+    if (isJumpToken) {
+        memset(((Token_terminalWithJump*)pToken)->jumpOffset, 0, sizeof(char[2]));                      // not yet resolved
+        _statementHasJumpTokens = true;
+    }
     _lastTokenStep = _programCounter - _programStorage;
 
     _lastTokenType = tokenType;
@@ -1503,7 +1625,7 @@ bool Justina::parseTerminalToken(char*& pNext, parsingResult_type& result) {
     _pDebugOut->print("   parsed terminal: step is "); _pDebugOut->print(_lastTokenStep); _pDebugOut->print(" [ "); _pDebugOut->print(_terminals[termIndex].terminalName);  _pDebugOut->println(" ]");
 #endif
 
-    _programCounter += sizeof(Token_terminal);
+    _programCounter += isJumpToken ? sizeof(Token_terminalWithJump) : sizeof(Token_terminal);
     *_programCounter = tok_no_token;                                                                    // indicates end of program
     result = result_parsing_OK;                                                                         // flag 'valid token found'
     return true;
@@ -1522,9 +1644,8 @@ bool Justina::parseAsInternCPPfunction(char*& pNext, parsingResult_type& result)
     if (!isalpha(pNext[0])) { return true; }                                                            // first character is not a letter ? Then it's not a function name (it can still be something else)
     while (isalnum(pNext[0]) || (pNext[0] == '_')) { pNext++; }                                         // do until first character after alphanumeric token (can be anything, including '\0')
 
-    for (funcIndex = _internCppFunctionCount - 1; funcIndex >= 0; funcIndex--) {                        // for all defined function names: check against alphanumeric token (NOT ending by '\0')
-        if (strlen(_internCppFunctions[funcIndex].funcName) != pNext - pch) { continue; }               // token has correct length ? If not, skip remainder of loop ('continue')                            
-        if (strncmp(_internCppFunctions[funcIndex].funcName, pch, pNext - pch) != 0) { continue; }      // token corresponds to function name ? If not, skip remainder of loop ('continue')    
+    funcIndex = findInternCppFunction(pch, pNext - pch);                                                // check alphanumeric token (NOT ending by '\0') against function names
+    if (funcIndex >= 0) {                                                                               // token corresponds to function name
 
         // token is a function, but is it allowed here ? If not, reset pointer to first character to parse, indicate error and return
         if (_programCounter == _programStorage) { pNext = pch; result = result_cmd_programCmdMissing; return false; }   // program mode and no PROGRAM command
@@ -1746,15 +1867,14 @@ bool Justina::parseAsJustinaFunction(char*& pNext, parsingResult_type& result) {
     createNewName = true;                                                                                               // if new Justina function, create storage for it
     index = getIdentifier(JustinaFunctionNames, _justinaFunctionCount, MAX_JUSTINA_FUNCTIONS, pch, pNext - pch, createNewName);
     if (index == -1) { pNext = pch; result = result_maxJustinaFunctionsReached; return false; }
-    char* funcName = JustinaFunctionNames[index];                                                                       // either new or existing function name
 
     // new function name (could be a function call or function definition)
     if (createNewName) {
         justinaFunctionData[index].isVoidFunctionDef = 0;                                                               // init flag (1 bit wide) to indicate a PROCEDURE (void function) definition
         justinaFunctionData[index].callsAsPartOfExpression = 0;                                                         // init flag (1 bit wide) to indicate that not all function calls occur at the start of a statement
 
-        // init max (bits 7654) & min (bits 3210) allowed n� OR actual n� of arguments; store in last position (behind string terminating character)
-        funcName[MAX_IDENT_NAME_LEN + 1] = c_JustinaFunctionFirstOccurFlag;                                             // max (bits 7654) < (bits 3210): indicates value is not yet updated by parsing previous calls closing parenthesis
+        // init max (bits 7654) & min (bits 3210) allowed n� OR actual n� of arguments
+        justinaFunctionData[index].minMaxArgCounts = c_JustinaFunctionFirstOccurFlag;                                   // max (bits 7654) < (bits 3210): indicates value is not yet updated by parsing previous calls closing parenthesis
         justinaFunctionData[index].pJustinaFunctionStartToken = nullptr;                                                // initialize. Pointer will be set when function definition is parsed (checked further down)
         justinaFunctionData[index].paramIsArrayPattern[1] = 0x80;                                                       // set flag (bit 15) to indicate a new function name is parsed (definition or call)
         justinaFunctionData[index].paramIsArrayPattern[0] = 0x00;                                                       // array pattern bits 7-0
@@ -1809,8 +1929,8 @@ bool Justina::parseAsJustinaFunction(char*& pNext, parsingResult_type& result) {
     // if function was defined prior to this occurrence (which is then a call), retrieve min & max allowed arguments for checking actual argument count
     // if function not yet defined: retrieve current state of min & max of actual argument count found in COMPLETELY PARSED previous calls to same function 
     // if no previous occurrences at all: data is not yet initialized (which is OK)
-    _minFunctionArgs = ((funcName[MAX_IDENT_NAME_LEN + 1]) >> 4) & 0x0F;                                                // use only for passing to parsing stack
-    _maxFunctionArgs = (funcName[MAX_IDENT_NAME_LEN + 1]) & 0x0F;
+    _minFunctionArgs = ((justinaFunctionData[index].minMaxArgCounts) >> 4) & 0x0F;                                                // use only for passing to parsing stack
+    _maxFunctionArgs = (justinaFunctionData[index].minMaxArgCounts) & 0x0F;
     _functionIndex = index;
 
     // expression syntax check 
@@ -1974,7 +2094,9 @@ bool Justina::parseAsVariable(char*& pNext, parsingResult_type& result) {
         if (!scalarWithAssignmentOp && !scalarWithoutInitializer) {
             if (!isProgramVar) {
                 // consider user variable not created (relevant for user variables only, because program variables are destroyed anyway if parsing fails)
+                removeUserVarName(_userVarCount - 1);
                 (*varNameCount[primaryNameRange])--;
+                rebuildIdentHashIndex(pvarNames[primaryNameRange], *varNameCount[primaryNameRange]);
                 _userVarUnderConstruction = false;                                                                      // user variable has just been 'deleted'
             }
             pNext = pch; result = result_assignmentOrSeparatorExpected; return false;
@@ -2489,6 +2611,480 @@ bool Justina::parseAsIdentifierName(char*& pNext, parsingResult_type& result) {
 }
 
 
+// -----------------------------------------------------------------------------------------------------------------
+// *   constant folding: replace the constant parts of a completely parsed expression by a single constant token   *
+// -----------------------------------------------------------------------------------------------------------------
+
+// called when a right parenthesis, a comma or a semicolon is parsed (before it is stored): the expression preceding it is complete
+// the expression is evaluated with the operator priorities and associativity used during execution (see execAllProcessedOperators()), with unknown values for...
+// ...variables, function results and parenthesis pairs not enclosing a single constant. Operations on numeric constants only are evaluated now (with the rules of... 
+// ...execUnaryOperation() and execInfixOperation()) and every largest constant operation (a token range) is replaced by one constant token
+// an operation that would produce an error (e.g. 0**0, division by zero) is not folded: the error will occur during execution, as before
+// the original tokens are kept for listing (pretty print): the constant token is followed by an end marker (a jump token) and by the original tokens,...
+// ...which are skipped during execution. If there is no room in program memory to store them, nothing is folded
+// each fold costs program memory: a constant token and an end marker (8 bytes). A single prefix operation on a literal (e.g. -1) is not folded
+
+void Justina::foldConstantExpression(int parenthesisLevel) {
+
+    // find the first token of the expression: the token following the left parenthesis of this parenthesis level (if nested), the last comma at this...
+    // ...parenthesis level or another token that can not be part of an expression (command keyword, generic name, ...) 
+    char* pEnd = _programCounter;
+    char* pExprStart = _programStorage + _statementStartStep;
+    int level{ 0 };
+    for (char* p = pExprStart; p < pEnd;) {
+        char* pFoldedOperationEnd = foldedConstantEnd(p);                                                       // constant folded before ? skip its original tokens 
+        if (pFoldedOperationEnd != nullptr) { p = pFoldedOperationEnd; continue; }
+
+        uint16_t tokenDecode = _tokenDecodeTable[(uint8_t)*p];
+        int tokenKind = tokenDecode >> 12;
+        int tokenType = *p & 0x0F;
+        p += (tokenDecode >> 8) & 0x0F;
+
+        if (tokenKind == tokKind_leftPar) { if (++level == parenthesisLevel) { pExprStart = p; } }
+        else if (tokenKind == tokKind_rightPar) { level--; }
+        else if (level == parenthesisLevel) {
+            bool isExpressionToken = (tokenKind == tokKind_operator) || (tokenType == tok_isConstant) || (tokenType == tok_isSymbolicConstant) || (tokenType == tok_isVariable) ||
+                (tokenType == tok_isInternCppFunction) || (tokenType == tok_isExternCppFunction) || (tokenType == tok_isJustinaFunction);
+            if (!isExpressionToken) { pExprStart = p; }
+        }
+    }
+    if (pExprStart == pEnd) { return; }                                                                         // empty expression
+
+    // evaluate the expression: operand and operator stacks
+    FoldOperand operands[MAX_FOLD_STACK_LEVELS], folds[MAX_FOLD_STACK_LEVELS];
+    FoldOperator operators[MAX_FOLD_STACK_LEVELS];
+    int operandCount{ 0 }, operatorCount{ 0 }, foldCount{ 0 };
+    bool expectOperand{ true };
+
+    char* p = pExprStart;
+    while (true) {
+        bool isEnd = (p == pEnd);
+        uint16_t tokenDecode = isEnd ? 0 : _tokenDecodeTable[(uint8_t)*p];
+        int tokenKind = tokenDecode >> 12;
+        int tokenType = isEnd ? tok_no_token : (*p & 0x0F);
+        int tokenLength = (tokenDecode >> 8) & 0x0F;
+        int terminalIndex = tokenDecode & 0x3F;
+
+        // operand: numeric constant (foldable), variable, function call, string constant or parenthesis pair
+        // --------------------------------------------------------------------------------------------------
+
+        if (!isEnd && (tokenKind != tokKind_operator)) {
+            if (!expectOperand || (operandCount == MAX_FOLD_STACK_LEVELS)) { return; }                          // operand not expected (never occurs) or stack full: do not fold 
+
+            FoldOperand& operand = operands[operandCount++];
+            operand.valueType = 0;                                                                              // init: not a numeric constant
+            operand.isOperationResult = false;
+            operand.startStep = p - _programStorage;
+
+            char* pNext = p;
+            char* pConst = nullptr;                                                                             // numeric constant token, if any
+            bool isVarOrFunction = (tokenType == tok_isVariable) || (tokenType == tok_isInternCppFunction) || (tokenType == tok_isExternCppFunction) ||
+                (tokenType == tok_isJustinaFunction);
+
+            if ((tokenType == tok_isConstant) || (tokenType == tok_isSymbolicConstant)) {
+                pConst = p;
+                char* pFoldedOperationEnd = foldedConstantEnd(p);                                               // constant folded before ? skip its original tokens
+                pNext = (pFoldedOperationEnd != nullptr) ? pFoldedOperationEnd : pNext + tokenLength;
+            }
+            else if ((tokenKind == tokKind_leftPar) || isVarOrFunction) {
+                if (isVarOrFunction) { pNext += tokenLength; }                                                  // array element or function call: skip subscripts or arguments
+                if ((pNext < pEnd) && ((_tokenDecodeTable[(uint8_t)*pNext] >> 12) == tokKind_leftPar)) {
+                    char* pLeftPar = pNext;
+                    int parLevel{ 0 };
+                    do {
+                        uint16_t decode = _tokenDecodeTable[(uint8_t)*pNext];
+                        if ((decode >> 12) == tokKind_leftPar) { parLevel++; }
+                        else if ((decode >> 12) == tokKind_rightPar) { parLevel--; }
+                        pNext += (decode >> 8) & 0x0F;
+                    } while ((parLevel > 0) && (pNext < pEnd));
+                    if (parLevel > 0) { return; }                                                               // never occurs
+
+                    // parenthesis pair enclosing one constant only (e.g. a constant expression folded when its right parenthesis was parsed) ?
+                    if (!isVarOrFunction) {
+                        char* pInner = pLeftPar + sizeof(Token_terminal);
+                        int innerType = *pInner & 0x0F;
+                        char* pInnerEnd = foldedConstantEnd(pInner);                                            // constant folded before ? skip its original tokens
+                        if (pInnerEnd == nullptr) { pInnerEnd = pInner + ((_tokenDecodeTable[(uint8_t)*pInner] >> 8) & 0x0F); }
+                        bool isConstInParentheses = ((innerType == tok_isConstant) || (innerType == tok_isSymbolicConstant)) && (pInnerEnd + sizeof(Token_terminal) == pNext);
+                        if (isConstInParentheses) { pConst = pInner; }
+                    }
+                }
+            }
+            else { return; }                                                                                    // any other token: never occurs
+
+            if (pConst != nullptr) {
+                char valueType = (*pConst >> 4) & value_typeMask;
+                if ((valueType == value_isLong) || (valueType == value_isFloat)) {                              // string constants are not folded
+                    operand.valueType = valueType;
+                    if (valueType == value_isLong) { memcpy(&operand.value.longConst, ((Token_constant*)pConst)->cstValue.longConst, sizeof(long)); }
+                    else { memcpy(&operand.value.floatConst, ((Token_constant*)pConst)->cstValue.floatConst, sizeof(float)); }
+                }
+            }
+
+            operand.endStep = pNext - _programStorage;
+            expectOperand = false;
+            p = pNext;
+            continue;
+        }
+
+        // postfix operator (increment, decrement): operand is a variable; executed immediately during execution (highest priority)
+        // ------------------------------------------------------------------------------------------------------------------------
+
+        bool isPrefix = expectOperand;
+        if (!isEnd && !isPrefix && (_terminals[terminalIndex].postfix_priority != 0)) {
+            operands[operandCount - 1].endStep = p + tokenLength - _programStorage;
+            p += tokenLength;
+            continue;
+        }
+
+        // an operand precedes an infix operator or the end of the expression: execute pending operations with a higher priority first
+        // ----------------------------------------------------------------------------------------------------------------------------
+
+        if (!expectOperand) {
+            int pendingPriority = isEnd ? -1 : _pendingTokenPriority[terminalIndex];
+            while (operatorCount > 0) {
+                FoldOperator& op = operators[operatorCount - 1];
+                int priority = op.isPrefix ? _prefixOpStackPriority[(int)op.terminalIndex] : _infixOpStackPriority[(int)op.terminalIndex];
+                if (priority <= pendingPriority) { break; }
+                operatorCount--;
+
+                FoldOperand& operand2 = operands[operandCount - 1];
+                if (op.isPrefix) {
+                    bool isConstant = (operand2.valueType != 0);
+                    if (isConstant) { isConstant = foldUnaryOperation(op.terminalIndex, operand2.value, operand2.valueType); }
+                    if (!isConstant) {                                                                          // fold operand before it becomes part of a non-constant operation
+                        if ((operand2.valueType != 0) && operand2.isOperationResult && (foldCount < MAX_FOLD_STACK_LEVELS)) { folds[foldCount++] = operand2; }
+                        operand2.valueType = 0;
+                    }
+                    operand2.startStep = op.step;
+                    operand2.isOperationResult = true;
+                }
+                else {
+                    FoldOperand& operand1 = operands[operandCount - 2];
+                    operandCount--;
+                    bool isConstant = (operand1.valueType != 0) && (operand2.valueType != 0);
+                    if (isConstant) { isConstant = foldInfixOperation(op.terminalIndex, operand1.value, operand1.valueType, operand2.value, operand2.valueType); }
+                    if (!isConstant) {                                                                          // fold operands before they become part of a non-constant operation
+                        if ((operand1.valueType != 0) && operand1.isOperationResult && (foldCount < MAX_FOLD_STACK_LEVELS)) { folds[foldCount++] = operand1; }
+                        if ((operand2.valueType != 0) && operand2.isOperationResult && (foldCount < MAX_FOLD_STACK_LEVELS)) { folds[foldCount++] = operand2; }
+                        operand1.valueType = 0;
+                    }
+                    operand1.endStep = operand2.endStep;
+                    operand1.isOperationResult = true;
+                }
+            }
+        }
+
+        if (isEnd) { break; }
+
+        // prefix or infix operator: push to operator stack
+        if (operatorCount == MAX_FOLD_STACK_LEVELS) { return; }                                                 // stack full: do not fold
+        operators[operatorCount].terminalIndex = terminalIndex;
+        operators[operatorCount].isPrefix = isPrefix;
+        operators[operatorCount].step = p - _programStorage;
+        operatorCount++;
+        expectOperand = true;
+        p += tokenLength;
+    }
+
+    if ((operandCount != 1) || (operatorCount != 0)) { return; }                                                // never occurs
+    if ((operands[0].valueType != 0) && operands[0].isOperationResult && (foldCount < MAX_FOLD_STACK_LEVELS)) { folds[foldCount++] = operands[0]; }
+
+    // a single prefix operator applied to a literal (e.g. a negative number) is not folded: the constant token and end marker would only cost program memory
+    int keptCount{ 0 };
+    for (int i = 0; i < foldCount; i++) {
+        char* pRangeStart = _programStorage + folds[i].startStep;
+        bool isPrefixOpOnLiteral = (folds[i].endStep - folds[i].startStep == sizeof(Token_terminal) + sizeof(Token_constant)) &&
+            ((_tokenDecodeTable[(uint8_t)*pRangeStart] >> 12) == tokKind_operator) && ((pRangeStart[sizeof(Token_terminal)] & 0x0F) == tok_isConstant);
+        if (!isPrefixOpOnLiteral) { folds[keptCount++] = folds[i]; }
+    }
+    foldCount = keptCount;
+    if (foldCount == 0) { return; }
+
+    // insert a constant token and an end marker before each token range, starting with the last range in program memory (token ranges do not overlap)
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+
+    for (int i = 1; i < foldCount; i++) {                                                                       // sort in descending order of start step
+        FoldOperand fold = folds[i];
+        int j = i - 1;
+        while ((j >= 0) && (folds[j].startStep < fold.startStep)) { folds[j + 1] = folds[j]; j--; }
+        folds[j + 1] = fold;
+    }
+
+    // check that there is still room to store the inserted tokens, the longest possible token + 2 extra ('tok_isEvalEnd' and ending '\0')
+    const int foldedConstTokenLength = sizeof(Token_constant) + sizeof(Token_terminalWithJump);
+    char* lastProgramByte = _programStorage + _PROGRAM_MEMORY_SIZE + (_programMode ? 0 : IMM_MEM_SIZE) - 1;
+    if ((pEnd + foldCount * foldedConstTokenLength + sizeof(Token_symbolicConstant) + 2) > lastProgramByte) { return; }   // no room: do not fold
+
+    for (int i = 0; i < foldCount; i++) {
+        char* pRangeStart = _programStorage + folds[i].startStep;
+        char* pRangeEnd = _programStorage + folds[i].endStep;
+        int insertedBytes = foldedConstTokenLength;
+
+        // constants folded before, within this range: remove the constant token and end marker, keep the original tokens
+        for (char* p = pRangeStart; p < pRangeEnd;) {
+            if (foldedConstantEnd(p) != nullptr) {
+                memmove(p, p + foldedConstTokenLength, pEnd - (p + foldedConstTokenLength));
+                pRangeEnd -= foldedConstTokenLength;
+                pEnd -= foldedConstTokenLength;
+                insertedBytes -= foldedConstTokenLength;
+                continue;
+            }
+            p += (_tokenDecodeTable[(uint8_t)*p] >> 8) & 0x0F;
+        }
+
+        memmove(pRangeStart + foldedConstTokenLength, pRangeStart, pEnd - pRangeStart);
+        pRangeEnd += foldedConstTokenLength;
+        pEnd += foldedConstTokenLength;
+        if (_lastVariableTokenStep >= folds[i].endStep) { _lastVariableTokenStep += insertedBytes; }
+
+        Token_constant* pToken = (Token_constant*)pRangeStart;
+        pToken->tokenType = tok_isConstant | (folds[i].valueType << 4);
+        if (folds[i].valueType == value_isLong) { memcpy(pToken->cstValue.longConst, &folds[i].value.longConst, sizeof(long)); }
+        else { memcpy(pToken->cstValue.floatConst, &folds[i].value.floatConst, sizeof(float)); }             // float not necessarily aligned with word size: copy memory instead
+
+        // end marker: jump offset to the token following the original tokens
+        Token_terminalWithJump* pMarker = (Token_terminalWithJump*)(pRangeStart + sizeof(Token_constant));
+        pMarker->tokenTypeAndIndex = _foldedConstEnd_token;
+        uint16_t jumpOffset = pRangeEnd - (char*)pMarker;
+        memcpy(pMarker->jumpOffset, &jumpOffset, sizeof(char[2]));
+    }
+
+    _programCounter = pEnd;
+    *_programCounter = tok_no_token;                                                                            // indicates end of program
+}
+
+
+// ---------------------------------------------------------------------------------------------------
+// *   constant folding: prefix operation on a numeric constant (rules as in execUnaryOperation())   *
+// ---------------------------------------------------------------------------------------------------
+
+// returns false if the operation can not be folded (it would produce an error during execution, or it is an increment or decrement)
+
+bool Justina::foldUnaryOperation(int terminalIndex, Val& operand, char& valueType) {
+    char terminalCode = _terminals[terminalIndex].terminalCode;
+    bool requiresLongOp = (_terminals[terminalIndex].prefix_priority & op_long);
+    bool resultCastLong = (_terminals[terminalIndex].prefix_priority & res_long);
+    bool opIsFloat = (valueType == value_isFloat);
+    bool opIsLong = (valueType == value_isLong);
+
+    if (!opIsLong && requiresLongOp) { return false; }                                                          // only integer value type allowed
+
+    Val opResult;
+    if (terminalCode == termcod_minus) { opIsFloat ? opResult.floatConst = -operand.floatConst : opResult.longConst = -operand.longConst; } // prefix minus 
+    else if (terminalCode == termcod_plus) { opResult = operand; } // prefix plus
+    else if (terminalCode == termcod_not) { opResult.longConst = opIsFloat ? (operand.floatConst == 0.) : (operand.longConst == 0); } // prefix: not
+    else if (terminalCode == termcod_bitCompl) { opResult.longConst = ~operand.longConst; }                     // prefix: bit complement
+    else { return false; }                                                                                      // increment, decrement: operand is a variable
+
+    int resultValueType = resultCastLong ? value_isLong : valueType;
+    if (resultValueType == value_isFloat) {                                                                     // floats only
+        if (isnan(opResult.floatConst) || !isfinite(opResult.floatConst)) { return false; }
+    }
+
+    operand = opResult;
+    valueType = resultValueType;
+    return true;
+}
+
+
+// -----------------------------------------------------------------------------------------------------
+// *   constant folding: infix operation on two numeric constants (rules as in execInfixOperation())   *
+// -----------------------------------------------------------------------------------------------------
+
+// returns false if the operation can not be folded (it would produce an error during execution, or it is an assignment)
+
+bool Justina::foldInfixOperation(int terminalIndex, Val& operand1, char& valueType1, Val operand2, char valueType2) {
+    int operatorCode = _terminals[terminalIndex].terminalCode;
+    if ((_terminals[terminalIndex].infix_priority & 0x1F) == 0x01) { return false; }                           // (pure or compound) assignment: operand 1 is a variable
+    bool requiresLongOp = (_terminals[terminalIndex].infix_priority & op_long);
+    bool resultCastLong = (_terminals[terminalIndex].infix_priority & res_long);
+
+    bool op1isLong = (valueType1 == value_isLong), op1isFloat = (valueType1 == value_isFloat);
+    bool op2isLong = (valueType2 == value_isLong), op2isFloat = (valueType2 == value_isFloat);
+
+    if (requiresLongOp && (!op1isLong || !op2isLong)) { return false; }                                         // integer operands expected
+
+    // promote an operand to float: '**' (power): any long operand; other operators: a long operand if the other operand is float
+    bool promoteOperandsToFloat = (operatorCode == termcod_pow) ? (op1isLong || op2isLong) : (op1isFloat ^ op2isFloat);
+    if (promoteOperandsToFloat) {
+        if (op1isLong) { operand1.floatConst = operand1.longConst; op1isLong = false; op1isFloat = true; }
+        if (op2isLong) { operand2.floatConst = operand2.longConst; op2isLong = false; op2isFloat = true; }
+    }
+
+    bool opResultLong = op2isLong || requiresLongOp || resultCastLong;
+    bool opResultFloat = op2isFloat && !(requiresLongOp || resultCastLong);
+
+    Val opResult;
+    switch (operatorCode) {
+
+        case termcod_plus:
+            opResultLong ? opResult.longConst = operand1.longConst + operand2.longConst : opResult.floatConst = operand1.floatConst + operand2.floatConst;
+            break;
+
+        case termcod_minus:
+            opResultLong ? opResult.longConst = operand1.longConst - operand2.longConst : opResult.floatConst = operand1.floatConst - operand2.floatConst;
+            break;
+
+        case termcod_mult:
+            opResultLong ? opResult.longConst = operand1.longConst * operand2.longConst : opResult.floatConst = operand1.floatConst * operand2.floatConst;
+            if (opResultFloat) { if ((operand1.floatConst != 0) && (operand2.floatConst != 0) && (!isnormal(opResult.floatConst))) { return false; } }   // underflow
+            break;
+
+        case termcod_div:
+            if (opResultFloat) { if ((operand1.floatConst != 0) && (operand2.floatConst == 0)) { return false; } }   // division by zero
+            else { if (operand2.longConst == 0) { return false; } }
+            opResultLong ? opResult.longConst = operand1.longConst / operand2.longConst : opResult.floatConst = operand1.floatConst / operand2.floatConst;
+            if (opResultFloat) { if ((operand1.floatConst != 0) && (!isnormal(opResult.floatConst))) { return false; } }  // underflow (or undefined, overflow)
+            break;
+
+        case termcod_pow:                                                                                       // operands always (converted to) floats
+            if ((operand1.floatConst == 0) && (operand2.floatConst == 0)) { return false; }                      // undefined (C++ pow() provides 1 as result)
+            opResult.floatConst = pow(operand1.floatConst, operand2.floatConst);
+            if ((operand1.floatConst != 0) && (!isnormal(opResult.floatConst))) { return false; }               // underflow (or undefined, overflow)
+            break;
+
+        case termcod_mod:
+            if (operand2.longConst == 0) { return false; }
+            opResult.longConst = operand1.longConst % operand2.longConst;
+            break;
+
+        case termcod_bitAnd:
+            opResult.longConst = operand1.longConst & operand2.longConst;
+            break;
+
+        case termcod_bitOr:
+            opResult.longConst = operand1.longConst | operand2.longConst;
+            break;
+
+        case termcod_bitXor:
+            opResult.longConst = operand1.longConst ^ operand2.longConst;
+            break;
+
+        case termcod_bitShLeft:
+        case termcod_bitShRight:
+            if ((operand2.longConst < 0) || (operand2.longConst >= 8 * sizeof(long))) { return false; }         // argument outside range
+            opResult.longConst = (operatorCode == termcod_bitShLeft) ? (operand1.longConst << operand2.longConst) : (operand1.longConst >> operand2.longConst);
+            break;
+
+        case termcod_and:
+            opResult.longConst = opResultLong ? (operand1.longConst && operand2.longConst) : (operand1.floatConst && operand2.floatConst);
+            break;
+
+        case termcod_or:
+            opResult.longConst = opResultLong ? (operand1.longConst || operand2.longConst) : (operand1.floatConst || operand2.floatConst);
+            break;
+
+        case termcod_lt:
+            opResult.longConst = opResultLong ? (operand1.longConst < operand2.longConst) : (operand1.floatConst < operand2.floatConst);
+            break;
+
+        case termcod_gt:
+            opResult.longConst = opResultLong ? (operand1.longConst > operand2.longConst) : (operand1.floatConst > operand2.floatConst);
+            break;
+
+        case termcod_eq:
+            opResult.longConst = opResultLong ? (operand1.longConst == operand2.longConst) : (operand1.floatConst == operand2.floatConst);
+            break;
+
+        case termcod_ltoe:
+            opResult.longConst = opResultLong ? (operand1.longConst <= operand2.longConst) : (operand1.floatConst <= operand2.floatConst);
+            break;
+
+        case termcod_gtoe:
+            opResult.longConst = opResultLong ? (operand1.longConst >= operand2.longConst) : (operand1.floatConst >= operand2.floatConst);
+            break;
+
+        case termcod_ne:
+            opResult.longConst = opResultLong ? (operand1.longConst != operand2.longConst) : (operand1.floatConst != operand2.floatConst);
+            break;
+
+        default:
+            return false;
+    }
+
+    if (opResultFloat) { if (isnan(opResult.floatConst) || !isfinite(opResult.floatConst)) { return false; } }  // undefined or overflow: error (or infinite value) during execution
+
+    operand1 = opResult;
+    valueType1 = opResultLong ? value_isLong : value_isFloat;
+    return true;
+}
+
+
+// ------------------------------------------------------------------------------------------------------------
+// *   short-circuit evaluation: store the jump offsets of the jump tokens of a completely parsed statement   *
+// ------------------------------------------------------------------------------------------------------------
+
+// called when the semicolon ending a statement is parsed (after constant folding and before the semicolon is stored), or at the end of the input if the final...
+// ...statement has no ending semicolon (before the 'no token' token is stored): the statement tokens will not move any more
+// - '&&' and '||' operators: offset to the token ending the right operand, at the same parenthesis level: an infix operator with a lower priority (as in...
+//   ...execAllProcessedOperators()), a comma, a right parenthesis or the semicolon. If the left operand decides the result, the right operand is skipped during execution
+// - lazy function (ifte, switch, choose) argument separators: offset to the next argument separator or to the closing parenthesis. Arguments not needed to...
+//   ...produce the function result are skipped during execution
+// offsets are relative to the jump token itself. A jump token that can not be resolved (too many pending jump tokens) keeps offset zero: nothing will be skipped
+
+void Justina::resolveJumpOffsets() {
+
+    PendingJump pendingJumps[MAX_PENDING_JUMPS];
+    int pendingCount{ 0 };
+    int parenthesisLevel{ 0 };
+    bool lastIsOperand{ false };                                                                                // last token ends an operand: an infix or postfix operator may follow
+
+    char* pEnd = _programCounter;                                                                               // the semicolon (or the ending no-token byte) will be stored here
+    for (char* p = _programStorage + _statementStartStep; p <= pEnd;) {
+        bool isEnd = (p == pEnd);
+        uint16_t tokenDecode = isEnd ? (tokKind_semicolon << 12) : _tokenDecodeTable[(uint8_t)*p];
+        int tokenKind = tokenDecode >> 12;
+        int tokenType = *p & 0x0F;
+        int terminalIndex = tokenDecode & 0x3F;
+
+        // jump tokens at this parenthesis level waiting for this token: comma, right parenthesis and semicolon end all of them...
+        // ...an infix operator only ends '&&' and '||' operators with a higher priority (precedence functions) 
+        int endPriority{ 0xFF };                                                                                // init: no pending jumps end here
+        bool isInfixOperator{ false };
+        if (tokenKind == tokKind_operator) {
+            isInfixOperator = lastIsOperand && (_terminals[terminalIndex].postfix_priority == 0);
+            if (isInfixOperator) { endPriority = _pendingTokenPriority[terminalIndex]; }
+        }
+        else if ((tokenKind == tokKind_comma) || (tokenKind == tokKind_rightPar) || (tokenKind == tokKind_semicolon)) { endPriority = -1; }
+
+        while ((pendingCount > 0) && (pendingJumps[pendingCount - 1].parenthesisLevel == parenthesisLevel) && (pendingJumps[pendingCount - 1].stackPriority > endPriority)) {
+            pendingCount--;
+            uint16_t jumpOffset = (p - _programStorage) - pendingJumps[pendingCount].step;
+            memcpy(((Token_terminalWithJump*)(_programStorage + pendingJumps[pendingCount].step))->jumpOffset, &jumpOffset, sizeof(char[2]));
+        }
+        if (isEnd) { break; }
+
+        // folded constant ? it is an operand: skip its original tokens (never executed)
+        char* pFoldedOperationEnd = foldedConstantEnd(p);
+        if (pFoldedOperationEnd != nullptr) { lastIsOperand = true; p = pFoldedOperationEnd; continue; }
+
+        // jump token ? wait for the token ending the operand or argument that can be skipped (if no room, the jump token is not resolved)
+        if (tokenKind != tokKind_notTerminal) {
+            int terminalCode = _terminals[terminalIndex].terminalCode;
+            bool isLazyArgSeparator = (terminalCode == termcod_comma_lazyArg);
+            bool isJumpToken = isLazyArgSeparator || (isInfixOperator && ((terminalCode == termcod_and) || (terminalCode == termcod_or)));
+            if (isJumpToken && (pendingCount < MAX_PENDING_JUMPS)) {
+                pendingJumps[pendingCount].step = p - _programStorage;
+                pendingJumps[pendingCount].parenthesisLevel = parenthesisLevel;
+                pendingJumps[pendingCount].stackPriority = isLazyArgSeparator ? 0 : _infixOpStackPriority[terminalIndex];
+                pendingCount++;
+            }
+        }
+
+        if (tokenKind == tokKind_leftPar) { parenthesisLevel++; }
+        else if (tokenKind == tokKind_rightPar) { parenthesisLevel--; }
+
+        // a postfix operator does not change this
+        if ((tokenKind != tokKind_operator) || isInfixOperator || !lastIsOperand) {
+            lastIsOperand = (tokenType == tok_isConstant) || (tokenType == tok_isSymbolicConstant) || (tokenType == tok_isVariable) || (tokenType == tok_isGenericName) ||
+                (tokenKind == tokKind_rightPar);
+        }
+        p += (tokenDecode >> 8) & 0x0F;
+    }
+}
+
+
 // --------------------------------------------------------------------------------------------
 // *   Array parsing: check that max dimension count and maximum array size is not exceeded   *
 // --------------------------------------------------------------------------------------------
@@ -2769,9 +3365,22 @@ bool Justina::parseString(char*& pNext, char*& pch, char*& pStringCst, char& val
 
     // token is an alphanumeric constant, and it's allowed here
     pStringCst = nullptr;                                                                       // init
-    if (pNext - (pch + 1) - escChars > 0) {    // not an empty string: create string object 
-        isIntermediateString ? _intermediateStringObjectCount++ : _parsedStringConstObjectCount++;
-        pStringCst = new char[pNext - (pch + 1) - escChars + 1];                                // create char array on the heap to store alphanumeric constant, including terminating '\0'
+    int length = pNext - (pch + 1) - escChars;
+
+    // non-empty string literal in a parsed program statement ? Store it in the string constant pool, unless an identical string is stored there already
+    bool isPooled = (length > 0) && !isIntermediateString && (_programCounter < _programStorage + _PROGRAM_MEMORY_SIZE);
+    uint32_t hash{};
+    if (isPooled) {
+        hash = stringLiteralHash(pch + 1, length);
+        pStringCst = findPooledStringConst(pch + 1, length, hash);                              // identical string literal found ? Share it
+    }
+
+    if ((length > 0) && (pStringCst == nullptr)) {    // not an empty string (and not shared): create string object 
+        if (isPooled) { pStringCst = stringConstPoolSpace(length); }
+        else {
+            isIntermediateString ? _intermediateStringObjectCount++ : _parsedStringConstObjectCount++;
+            pStringCst = new char[length + 1];                                                  // create char array on the heap to store alphanumeric constant, including terminating '\0'
+        }
         // store alphanumeric constant in newly created character array
         pStringCst[pNext - (pch + 1) - escChars] = '\0';                                        // store string terminating '\0' (pch + 1 points to character after opening quote, pNext points to closing quote)
         char* pSource = pch + 1, * pDestin = pStringCst;                                        // pSource points to character after opening quote
@@ -2785,9 +3394,12 @@ bool Justina::parseString(char*& pNext, char*& pch, char*& pStringCst, char& val
             }
 
         }
+        if (isPooled) { addToStringConstPool(pStringCst, length, hash); }
     #if PRINT_HEAP_OBJ_CREA_DEL
-        _pDebugOut->print(isIntermediateString ? "\r\n+++++ (Intermd str) " : "\r\n+++++ (parsed str ) "); _pDebugOut->println((uint32_t)pStringCst, HEX);
-        _pDebugOut->print("       parse string "); _pDebugOut->println(pStringCst);
+        else {
+            _pDebugOut->print(isIntermediateString ? "\r\n+++++ (Intermd str) " : "\r\n+++++ (parsed str ) "); _pDebugOut->println((uint32_t)pStringCst, HEX);
+            _pDebugOut->print("       parse string "); _pDebugOut->println(pStringCst);
+        }
     #endif
     }
     pNext++;                                                                                    // skip closing quote
@@ -2802,18 +3414,23 @@ bool Justina::parseString(char*& pNext, char*& pch, char*& pStringCst, char& val
 // *   check if identifier storage exists already, optionally create new   *
 // -------------------------------------------------------------------------
 
+// the identifier name is looked up in the hash index of the identifier name array: the probe sequence ends at the first empty hash table entry 
+
 int Justina::getIdentifier(char** pIdentNameArray, int& identifiersInUse, int maxIdentifiers, char* pIdentNameToCheck, int identLength, bool& createNewName, bool isUserVar) {
 
     char* pIdentifierName;
-    int index = 0;          // points to last variable in use
-    while (index < identifiersInUse) {                       // points to variable in use
-        pIdentifierName = pIdentNameArray[index];
-        if (strlen(pIdentifierName) == identLength) {                                           // identifier with name with same length found
-            if (strncmp(pIdentifierName, pIdentNameToCheck, identLength) == 0) { break; }       // storage for identifier name was created already 
+    int hashTableSize{};
+    uint8_t* pHashIndex = getIdentHashIndex(pIdentNameArray, hashTableSize);
+    int hashSlot = identNameHash(pIdentNameToCheck, identLength) % hashTableSize;
+
+    int index = -1;
+    while (pHashIndex[hashSlot] != 0) {                                                         // hash table never full: at least half of the entries are empty
+        pIdentifierName = pIdentNameArray[pHashIndex[hashSlot] - 1];
+        if (((uint8_t)pIdentifierName[-1] == identLength) && (strncmp(pIdentifierName, pIdentNameToCheck, identLength) == 0)) {  // name length (preceding name) and name match
+            index = pHashIndex[hashSlot] - 1; break;
         }
-        index++;
+        if (++hashSlot == hashTableSize) { hashSlot = 0; }
     }
-    if (index == identifiersInUse) { index = -1; }                                              // not found
     if (!createNewName) { return index; }                                                       // if check only: identNameIndex to identifier name or -1, createNewName = false
 
     createNewName = (index == -1);                                                              // create new ?
@@ -2825,21 +3442,281 @@ int Justina::getIdentifier(char** pIdentNameArray, int& identifiersInUse, int ma
     if (createNewName) {
         if (identifiersInUse == maxIdentifiers) { return index; }                               // create identifier name failed: return -1 with createNewName = true
         isUserVar ? _userVarNameStringObjectCount++ : _identifierNameStringObjectCount++;
-        pIdentifierName = new char[MAX_IDENT_NAME_LEN + 1 + 1];                                 // create standard length char array on the heap, including '\0' and an extra character 
-        strncpy(pIdentifierName, pIdentNameToCheck, identLength);                               // store identifier name in newly created character array
-        pIdentifierName[identLength] = '\0';                                                    // string terminating '\0'
+        pIdentifierName = storeIdentName(pIdentNameToCheck, identLength, isUserVar);            // store identifier name (exact length) in identifier name arena
     #if PRINT_HEAP_OBJ_CREA_DEL
         _pDebugOut->print(isUserVar ? "\r\n+++++ (usrvar name) " : "\r\n+++++ (ident name ) "); _pDebugOut->println((uint32_t)pIdentifierName, HEX);
         _pDebugOut->print("     get identifier "); _pDebugOut->println(pIdentifierName);
     #endif
         pIdentNameArray[identifiersInUse] = pIdentifierName;
+        pHashIndex[hashSlot] = identifiersInUse + 1;                                            // first empty hash table entry in probe sequence
         identifiersInUse++;
+        if (isUserVar) { clearEvalCache(); deleteAllParsedDebugExpressions(); clearBatchLineCaches(); }     // a cached eval() string (or parsed watch string, batch file line) may refer to a program variable with the same name
         return identifiersInUse - 1;                                                            // identNameIndex to newly created identifier name
     }
     else { return index; }
 }
 
 
+// -------------------------------------------------
+// *   identifier name hash (32-bit FNV-1a hash)   *
+// -------------------------------------------------
+
+uint32_t Justina::identNameHash(const char* pIdentName, int identLength) {
+    uint32_t hash = 2166136261UL;                                                               // FNV offset basis
+    for (int i = 0; i < identLength; i++) { hash = (hash ^ (uint8_t)pIdentName[i]) * 16777619UL; }  // FNV prime
+    return hash;
+}
+
+
+// -------------------------------------------------------------------------
+// *   return the hash index (and its size) for an identifier name array   *
+// -------------------------------------------------------------------------
+
+uint8_t* Justina::getIdentHashIndex(char** pIdentNameArray, int& hashTableSize) {
+    if (pIdentNameArray == userVarNames) { hashTableSize = USERVAR_HASH_TABLE_SIZE; return userVarNameHashIndex; }
+    else if (pIdentNameArray == programVarNames) { hashTableSize = PROGVAR_HASH_TABLE_SIZE; return programVarNameHashIndex; }
+    else { hashTableSize = FUNC_HASH_TABLE_SIZE; return JustinaFunctionNameHashIndex; }
+}
+
+
+// ----------------------------------------------------------------------------------
+// *   rebuild the hash index for an identifier name array (after deleting names)   *
+// ----------------------------------------------------------------------------------
+
+// identifiers that were removed from the name array (or moved to another index) are not tracked individually: the hash index is rebuilt entirely
+// with zero identifiers in use, the hash index is simply cleared
+
+void Justina::rebuildIdentHashIndex(char** pIdentNameArray, int identifiersInUse) {
+    int hashTableSize{};
+    uint8_t* pHashIndex = getIdentHashIndex(pIdentNameArray, hashTableSize);
+    memset(pHashIndex, 0, hashTableSize);
+
+    for (int index = 0; index < identifiersInUse; index++) {
+        int hashSlot = identNameHash(pIdentNameArray[index], (uint8_t)pIdentNameArray[index][-1]) % hashTableSize;     // name length precedes name
+        while (pHashIndex[hashSlot] != 0) { if (++hashSlot == hashTableSize) { hashSlot = 0; } }    // find first empty entry
+        pHashIndex[hashSlot] = index + 1;
+    }
+}
+
+
+// --------------------------------------------------------------------------------------
+// *   store an identifier name in the program or user variable identifier name arena   *
+// --------------------------------------------------------------------------------------
+
+// names are stored back to back: a length byte, the name and a terminating '\0' (exact size: no space reserved for the maximum name length)
+// if the arena is full, an arena twice the size is created and all names are moved: name pointers in the name arrays using the arena are adapted
+// returns a pointer to the stored name
+
+char* Justina::storeIdentName(char* pIdentName, int identLength, bool isUserVar) {
+    IdentNameArena& arena = isUserVar ? _userVarNameArena : _programNameArena;
+    int required = identLength + 2;                                                             // length byte, name, terminating '\0'
+
+    if (arena.used + required > arena.size) {                                                   // arena full: create a larger one
+        int newSize = (arena.size < IDENT_NAME_ARENA_MIN_SIZE) ? IDENT_NAME_ARENA_MIN_SIZE : 2 * arena.size;  // grow geometrically: names are moved a limited number of times
+        if (newSize < arena.used + required) { newSize = arena.used + required; }
+        char* pNewArea = new char[newSize];
+        if (arena.pArea != nullptr) {
+            memcpy(pNewArea, arena.pArea, arena.used);
+            if (isUserVar) { for (int i = 0; i < _userVarCount; i++) { userVarNames[i] = pNewArea + (userVarNames[i] - arena.pArea); } }
+            else {
+                for (int i = 0; i < _programVarNameCount; i++) { programVarNames[i] = pNewArea + (programVarNames[i] - arena.pArea); }
+                for (int i = 0; i < _justinaFunctionCount; i++) { JustinaFunctionNames[i] = pNewArea + (JustinaFunctionNames[i] - arena.pArea); }
+            }
+            delete[] arena.pArea;
+        }
+        arena.pArea = pNewArea;
+        arena.size = newSize;
+    }
+
+    char* pIdentifierName = arena.pArea + arena.used + 1;                                       // skip length byte
+    pIdentifierName[-1] = (char)identLength;
+    memcpy(pIdentifierName, pIdentName, identLength);
+    pIdentifierName[identLength] = '\0';
+    arena.used += required;
+    return pIdentifierName;
+}
+
+
+// ---------------------------------------------------------------------
+// *   remove a user variable name from the user variable name arena   *
+// ---------------------------------------------------------------------
+
+// user variable names are stored in the arena in the order of the user variable name array: names of next user variables move down (compaction)
+// the caller removes the name from the user variable name array
+
+void Justina::removeUserVarName(int index) {
+    char* pRemovedName = userVarNames[index] - 1;                                               // start of length byte
+    int removedSize = (uint8_t)pRemovedName[0] + 2;                                             // length byte, name, terminating '\0'
+    char* pEnd = _userVarNameArena.pArea + _userVarNameArena.used;
+    memmove(pRemovedName, pRemovedName + removedSize, pEnd - (pRemovedName + removedSize));
+    for (int i = index + 1; i < _userVarCount; i++) { userVarNames[i] -= removedSize; }
+    _userVarNameArena.used -= removedSize;
+    _userVarNameStringObjectCount--;
+
+    if (_userVarNameArena.used == 0) { resetIdentNameArena(_userVarNameArena); }               // no user variable names left: delete arena
+}
+
+
+// -----------------------------------------------------------------
+// *   reset an identifier name arena (delete all names at once)   *
+// -----------------------------------------------------------------
+
+// note: the identifier name object counts are maintained by the caller
+
+void Justina::resetIdentNameArena(IdentNameArena& arena) {
+    if (arena.pArea != nullptr) { delete[] arena.pArea; }
+    arena.pArea = nullptr;
+    arena.size = 0;
+    arena.used = 0;
+}
+
+
+// -----------------------------------------------------------------------------
+// *   hash of a string literal (escape sequences are decoded while hashing)   *
+// -----------------------------------------------------------------------------
+
+// string literals in parsed program statements are not stored as separate heap objects, but back to back in a pool of chunks:...
+// ...2 length bytes, the string and a terminating '\0'. Chunks are never moved, so parsed statements can point to the strings. Clearing the program deletes all chunks at once
+// a hash index of the pooled strings lets identical string literals share one copy: a string literal is looked up (in the parser input, before it is decoded)...
+// ...and only stored in the pool if not found
+// 'pLiteral' points to the first character after the opening quote; 'length' is the length of the decoded string
+
+uint32_t Justina::stringLiteralHash(const char* pLiteral, int length) {
+    uint32_t hash = 2166136261UL;                                                               // FNV offset basis
+    for (int i = 0; i < length; i++) {
+        char c = *pLiteral++;
+        if (c == '\\') { c = *pLiteral++; if (c == 'r') { c = '\r'; } else if (c == 'n') { c = '\n'; } }   // escape sequence
+        hash = (hash ^ (uint8_t)c) * 16777619UL;                                                // FNV prime
+    }
+    return hash;
+}
+
+
+// ----------------------------------------------------------------------------------------
+// *   find a string literal in the string constant pool (returns nullptr if not found)   *
+// ----------------------------------------------------------------------------------------
+
+char* Justina::findPooledStringConst(const char* pLiteral, int length, uint32_t hash) {
+    if (_pStringConstHashIndex == nullptr) { return nullptr; }
+
+    for (int hashSlot = hash % STRING_CONST_HASH_TABLE_SIZE; _pStringConstHashIndex[hashSlot] != nullptr; hashSlot = (hashSlot + 1) % STRING_CONST_HASH_TABLE_SIZE) {
+        char* pString = _pStringConstHashIndex[hashSlot];
+        uint16_t pooledLength{};
+        memcpy(&pooledLength, pString - 2, sizeof(pooledLength));                               // not aligned: copy memory
+        if (pooledLength != length) { continue; }
+
+        const char* p = pLiteral;
+        int i{ 0 };
+        for (; i < length; i++) {
+            char c = *p++;
+            if (c == '\\') { c = *p++; if (c == 'r') { c = '\r'; } else if (c == 'n') { c = '\n'; } }   // escape sequence
+            if (c != pString[i]) { break; }
+        }
+        if (i == length) { return pString; }                                                    // identical string found
+    }
+    return nullptr;
+}
+
+
+// -------------------------------------------------------------------------
+// *   reserve space for a string at the end of the string constant pool   *
+// -------------------------------------------------------------------------
+
+// only called for a string literal that is not in the pool yet: the caller decodes the string into the space returned and then calls addToStringConstPool()
+
+char* Justina::stringConstPoolSpace(int length) {
+    int required = length + 3;                                                                  // 2 length bytes, string, terminating '\0'
+
+    if ((_pStringConstPool == nullptr) || (_pStringConstPool->used + required > _pStringConstPool->size)) {    // no room in chunk in use: create a new chunk
+        int chunkSize = (required > STRING_CONST_POOL_CHUNK) ? required : STRING_CONST_POOL_CHUNK;
+        StringConstPoolChunk* pNewChunk = (StringConstPoolChunk*)new char[sizeof(StringConstPoolChunk) + chunkSize];
+        _parsedStringConstObjectCount++;                                                        // one object per chunk
+    #if PRINT_HEAP_OBJ_CREA_DEL
+        _pDebugOut->print("\r\n+++++ (parsed str ) "); _pDebugOut->println((uint32_t)pNewChunk, HEX);
+        _pDebugOut->println("   str. const. pool chunk");
+    #endif
+        pNewChunk->pNextChunk = _pStringConstPool;
+        pNewChunk->size = chunkSize;
+        pNewChunk->used = 0;
+        _pStringConstPool = pNewChunk;
+    }
+
+    return (char*)(_pStringConstPool + 1) + _pStringConstPool->used + 2;                       // skip length bytes
+}
+
+
+// ------------------------------------------------------------------------------
+// *   keep a string stored in the space reserved in the string constant pool   *
+// ------------------------------------------------------------------------------
+
+// the string is added to the hash index, unless the index is full (the string is then pooled, but identical string literals parsed later will not share it)
+
+void Justina::addToStringConstPool(char* pString, int length, uint32_t hash) {
+    uint16_t pooledLength = length;
+    memcpy(pString - 2, &pooledLength, sizeof(pooledLength));                                   // not aligned: copy memory
+    pString[length] = '\0';
+    _pStringConstPool->used += length + 3;
+
+    if (_pStringConstHashIndex == nullptr) {                                                    // first string: create the hash index
+        _pStringConstHashIndex = new char* [STRING_CONST_HASH_TABLE_SIZE];
+        _parsedStringConstObjectCount++;
+    #if PRINT_HEAP_OBJ_CREA_DEL
+        _pDebugOut->print("\r\n+++++ (parsed str ) "); _pDebugOut->println((uint32_t)_pStringConstHashIndex, HEX);
+        _pDebugOut->println("   str. const. hash index");
+    #endif
+        for (int i = 0; i < STRING_CONST_HASH_TABLE_SIZE; i++) { _pStringConstHashIndex[i] = nullptr; }
+    }
+    if (_indexedStringConstCount >= MAX_INDEXED_STRING_CONSTS) { return; }                      // hash index is full
+
+    int hashSlot = hash % STRING_CONST_HASH_TABLE_SIZE;
+    while (_pStringConstHashIndex[hashSlot] != nullptr) { if (++hashSlot == STRING_CONST_HASH_TABLE_SIZE) { hashSlot = 0; } }   // find first empty entry
+    _pStringConstHashIndex[hashSlot] = pString;
+    _indexedStringConstCount++;
+}
+
+
+// --------------------------------------------------------
+// *   is a string stored in the string constant pool ?   *
+// --------------------------------------------------------
+
+bool Justina::isPooledStringConst(char* pString) {
+    for (StringConstPoolChunk* pChunk = _pStringConstPool; pChunk != nullptr; pChunk = pChunk->pNextChunk) {
+        char* pStrings = (char*)(pChunk + 1);
+        if ((pString >= pStrings) && (pString < pStrings + pChunk->used)) { return true; }
+    }
+    return false;
+}
+
+
+// ---------------------------------------------------------------------
+// *   delete the string constant pool (all program string literals)   *
+// ---------------------------------------------------------------------
+
+void Justina::deleteStringConstPool() {
+    while (_pStringConstPool != nullptr) {
+        StringConstPoolChunk* pChunk = _pStringConstPool;
+        _pStringConstPool = pChunk->pNextChunk;
+    #if PRINT_HEAP_OBJ_CREA_DEL
+        _pDebugOut->print("\r\n----- (parsed str ) "); _pDebugOut->println((uint32_t)pChunk, HEX);
+        _pDebugOut->println("   str. const. pool chunk");
+    #endif
+        _parsedStringConstObjectCount--;
+        delete[] (char*)pChunk;
+    }
+
+    if (_pStringConstHashIndex != nullptr) {
+    #if PRINT_HEAP_OBJ_CREA_DEL
+        _pDebugOut->print("\r\n----- (parsed str ) "); _pDebugOut->println((uint32_t)_pStringConstHashIndex, HEX);
+        _pDebugOut->println("   str. const. hash index");
+    #endif
+        _parsedStringConstObjectCount--;
+        delete[] _pStringConstHashIndex;
+        _pStringConstHashIndex = nullptr;
+    }
+    _indexedStringConstCount = 0;
+}
+
+
 // --------------------------------------------------------------
 // *   initialize a variable or an array with (a) constant(s)   *
 // --------------------------------------------------------------
@@ -2948,8 +3825,7 @@ Justina::parsingResult_type Justina::deleteUserVariable(char* userVarName) {
         _pDebugOut->print("\r\n----- (usrvar name) "); _pDebugOut->println((uint32_t) * (userVarNames + index), HEX);
         _pDebugOut->print("    delete user var "); _pDebugOut->println(*(userVarNames + index));
     #endif
-        _userVarNameStringObjectCount--;
-        delete[] * (userVarNames + index);
+        removeUserVarName(index);                                                                           // remove name from user variable name arena
 
         // 2. if variable is an array of strings: delete all non-empty strings in array
         // ----------------------------------------------------------------------------
@@ -3005,6 +3881,10 @@ Justina::parsingResult_type Justina::deleteUserVariable(char* userVarName) {
     }
 
     if (!varDeleted) { return result_variableNameExpected; }
+    rebuildIdentHashIndex(userVarNames, _userVarCount);                                                    // user variable indexes have changed
+    clearEvalCache();                                                                                       // cached eval() strings refer to user variables by index
+    deleteAllParsedDebugExpressions();                                                                      // parsed watch and breakpoint condition strings as well
+    clearBatchLineCaches();                                                                                 // and parsed batch file lines
 
     return result_parsing_OK;
 }
@@ -39,6 +39,8 @@ Breakpoints::Breakpoints(Justina* pJustina, long lineRanges_memorySize, long max
     // NOTE: objects created / deleted in constructors / destructors are not counted
     _BPlineRangeStorage = new char[_BPLineRangeMemorySize];
     _pBreakpointData = new BreakpointData[_maxBreakpointCount];         // store active breakpoint
+    _BPstepHashTableSize = 2 * _maxBreakpointCount + 1;
+    _pBPstepHashIndex = new uint8_t[_BPstepHashTableSize]();           // no breakpoints: all entries empty
 
     _BPlineRangeStorageUsed = 0;                                        // in bytes
     _breakpointsUsed = 0;                                               // no breakpoints set
@@ -52,6 +54,7 @@ Breakpoints::Breakpoints(Justina* pJustina, long lineRanges_memorySize, long max
 Breakpoints::~Breakpoints() {
     // NOTE: objects created / deleted in constructors / destructors are not counted
     delete[] _pBreakpointData;
+    delete[] _pBPstepHashIndex;
     delete[] _BPlineRangeStorage;
 }
 
@@ -64,12 +67,16 @@ void Breakpoints::resetBreakpointsState() {
     for (int i = 0; i < _breakpointsUsed; i++) {
         _pJustina->setNewSystemExpression(_pBreakpointData[i].pWatch, nullptr);        // remove any heap objects created for non-empty watch or condition strings    
         _pJustina->setNewSystemExpression(_pBreakpointData[i].pCondition, nullptr);
+        _pJustina->deleteParsedExpressions(_pBreakpointData[i].pParsedWatch);
+        _pJustina->deleteParsedExpressions(_pBreakpointData[i].pParsedCondition);
     }
 
     _BPlineRangeStorageUsed = 0;
     _breakpointsUsed = 0;
     _breakpointsAreOn = true;
     _breakpointsStatusDraft = false;
+    rebuildBPstepHashIndex();
+    _pJustina->updateDebugMachineryArmed();
 }
 
 
@@ -359,6 +366,8 @@ Justina::execResult_type Breakpoints::maintainBreakpointTable(long sourceLine, c
         _pBreakpointData[entry].pProgramStep = pProgramStep;                            // if status DRAFT, then pProgramStep is dummy
         _pBreakpointData[entry].pWatch = nullptr;
         _pBreakpointData[entry].pCondition = nullptr;
+        _pBreakpointData[entry].pParsedWatch = nullptr;
+        _pBreakpointData[entry].pParsedCondition = nullptr;
         _breakpointsUsed++;
         doInsertNewBP = true;
     }
@@ -372,6 +381,7 @@ Justina::execResult_type Breakpoints::maintainBreakpointTable(long sourceLine, c
         if (!keepWatch) {
             _pBreakpointData[entry].BPwithWatchExpr = (watchString == nullptr) ? 0b0 : 0b1;
             _pJustina->setNewSystemExpression(_pBreakpointData[entry].pWatch, watchString);
+            _pJustina->deleteParsedExpressions(_pBreakpointData[entry].pParsedWatch);       // parse new watch string at next breakpoint stop
         }
         if (!keepCondition) {
             _pBreakpointData[entry].BPwithHitCount = (hitCount > 0) ? 0b1 : 0b0;
@@ -380,6 +390,7 @@ Justina::execResult_type Breakpoints::maintainBreakpointTable(long sourceLine, c
             _pBreakpointData[entry].hitCount = hitCount;
             _pBreakpointData[entry].hitCounter = 0;
             _pJustina->setNewSystemExpression(_pBreakpointData[entry].pCondition, conditionString);
+            _pJustina->deleteParsedExpressions(_pBreakpointData[entry].pParsedCondition);   // parse new condition string when breakpoint is reached
         }
     }
 
@@ -401,6 +412,8 @@ Justina::execResult_type Breakpoints::maintainBreakpointTable(long sourceLine, c
         }
     }
 
+    rebuildBPstepHashIndex();                                                   // breakpoint table rows have changed
+    _pJustina->updateDebugMachineryArmed();
     return Justina::result_exec_OK;
 }
 
@@ -457,15 +470,47 @@ void Breakpoints::printBreakpoints() {
 // *   find breakpoint table entry for a parsed statement start address   *
 // ------------------------------------------------------------------------
 
+// the hash index is probed (no linear search of the breakpoint table)
+
 Breakpoints::BreakpointData* Breakpoints::findBPtableRow(char* pParsedStatement, int& row) {
-    for (int i = 0; i < _breakpointsUsed; i++) {
+    int hashSlot = BPstepHash(pParsedStatement);
+    while (_pBPstepHashIndex[hashSlot] != 0) {                                  // an empty entry ends the probe sequence
+        int i = _pBPstepHashIndex[hashSlot] - 1;
         if (_pBreakpointData[i].pProgramStep == pParsedStatement) { row = i;  return _pBreakpointData + i; }
+        if (++hashSlot == _BPstepHashTableSize) { hashSlot = 0; }
     }
     row = -1;               // no match
     return nullptr;
 };
 
 
+// -------------------------------------------------------------------------------------
+// *   hash index of breakpoint table: hash table entry for a parsed statement start   *
+// -------------------------------------------------------------------------------------
+
+int Breakpoints::BPstepHash(char* pParsedStatement) {
+    return (uint32_t)(pParsedStatement - _pJustina->_programStorage) % _BPstepHashTableSize;      // program steps fit in 16 bits
+}
+
+
+// ---------------------------------------------------------------------------------------------
+// *   rebuild the hash index of the breakpoint table (after changing breakpoint table rows)   *
+// ---------------------------------------------------------------------------------------------
+
+// while the breakpoint table has status DRAFT, program steps are dummies: they are only looked up after activation
+
+void Breakpoints::rebuildBPstepHashIndex() {
+    memset(_pBPstepHashIndex, 0, _BPstepHashTableSize);
+    if (_breakpointsStatusDraft) { return; }
+
+    for (int i = 0; i < _breakpointsUsed; i++) {
+        int hashSlot = BPstepHash(_pBreakpointData[i].pProgramStep);
+        while (_pBPstepHashIndex[hashSlot] != 0) { if (++hashSlot == _BPstepHashTableSize) { hashSlot = 0; } }     // find first empty entry
+        _pBPstepHashIndex[hashSlot] = i + 1;
+    }
+}
+
+
 // --------------------------------------------------------------------
 // *   find source line number for a parsed statement start address   *
 // --------------------------------------------------------------------
@@ -511,9 +556,11 @@ Justina::execResult_type Breakpoints::tryBPactivation() {
                 char* pProgramStep{ nullptr };
                 Justina::execResult_type execResult = progMem_getSetClearBP(lineSequenceNum, pProgramStep, (i == 2));   // i=1: check for errors only, 2 = set BP in memory
                 if (execResult != Justina::result_exec_OK) { return Justina::execResult_type::result_BP_nonExecStatementsInTable; }
+                if (i == 2) { _pBreakpointData[entry].pProgramStep = pProgramStep; }                   // was a dummy while status was DRAFT
             }
         }
         _breakpointsStatusDraft = false;
+        rebuildBPstepHashIndex();
     }
     return Justina::execResult_type::result_exec_OK;
 }
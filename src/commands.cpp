@@ -239,6 +239,7 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                 (_activeFunctionData.activeCmd_commandCode == cmdcod_stepOutOfBlock) ? (OpenBlock ? db_stepOutOfBlock : db_singleStep) :
                 (_activeFunctionData.activeCmd_commandCode == cmdcod_stepToBlockEnd) ? (OpenBlock ? db_stepToBlockEnd : db_singleStep) :
                 db_continue;
+            updateDebugMachineryArmed();
 
             // currently, at least one program is stopped (we are in debug mode)
             // find the flow control stack entry for the stopped function and make it the active function again (remove the flow control stack level for the debugging command line)
@@ -280,6 +281,7 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
             if (!opIsString) { return result_arg_stringExpected; }
 
             setNewSystemExpression(_pwatchString, value.pStringConst);
+            deleteParsedExpressions(_pParsedWatchString);                   // parse new watch string at next stop
 
             // clean up
             clearEvalStackLevels(cmdArgCount);                              // clear evaluation stack and intermediate strings
@@ -311,6 +313,7 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
         case cmdcod_debug:
         {
             _debugCmdExecuted = true;
+            _debugMachineryArmed = true;
 
             // clean up
             clearEvalStackLevels(cmdArgCount);                              // clear evaluation stack and intermediate strings 
@@ -327,6 +330,52 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
         case cmdcod_BPoff:
         {
             _pBreakpoints->_breakpointsAreOn = (_activeFunctionData.activeCmd_commandCode == cmdcod_BPon);
+            updateDebugMachineryArmed();
+
+            // clean up
+            clearEvalStackLevels(cmdArgCount);                              // clear evaluation stack and intermediate strings 
+            _activeFunctionData.activeCmd_commandCode = cmdcod_none;        // command execution ended
+        }
+        break;
+
+
+        // ------------------------------------------------------
+        // switch profiler on (counters are cleared first) or off
+        // ------------------------------------------------------
+
+        case cmdcod_profileOn:
+        case cmdcod_profileOff:
+        {
+            if (_pProfileFunctions == nullptr) { return result_profilerNotAvailable; }
+
+            if (_activeFunctionData.activeCmd_commandCode == cmdcod_profileOn) {
+                clearProfile();
+                _profileLastTime = micros();
+                _profilingOn = true;                                        // profiling starts with the next statement
+            }
+            else if (_profilingOn) {
+                profileStop();                                              // charge time spent until now (counters are kept)
+                _profilingOn = false;
+            }
+
+            // clean up
+            clearEvalStackLevels(cmdArgCount);                              // clear evaluation stack and intermediate strings 
+            _activeFunctionData.activeCmd_commandCode = cmdcod_none;        // command execution ended
+        }
+        break;
+
+
+        // -------------------------------------------------------
+        // switch tracer on (trace buffer is cleared first) or off
+        // -------------------------------------------------------
+
+        case cmdcod_traceOn:
+        case cmdcod_traceOff:
+        {
+            if (_pTraceEvents == nullptr) { return result_tracerNotAvailable; }
+
+            if (_activeFunctionData.activeCmd_commandCode == cmdcod_traceOn) { clearTrace(); }
+            _tracingOn = (_activeFunctionData.activeCmd_commandCode == cmdcod_traceOn);     // trace events are kept when tracing is switched off
 
             // clean up
             clearEvalStackLevels(cmdArgCount);                              // clear evaluation stack and intermediate strings 
@@ -857,7 +906,7 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
         {
             /* ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
                 A label is defined as the first part of a single-line comment, which must start at the beginning of a line. It is terminated by two colons (':'), followed by an optional comment.
-                Spaces are allowed within a label. The starting slashes and the ending colons themselves are not part of the label.
+                Spaces are allowed within a label. The starting slashes and the ending colons themselves are not part of the label. Max. label length: MAX_BATCH_LABEL_LEN (63) characters.
                 Label example (quotes added for clarity here): '//loop start::' this is the start of a multi-line loop in a batch file'
                 Use the 'gotoLabel' command within a (while, if...) block structure to implement conditional back and forward jumps to a defined label within the batch file.
             ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------- */
@@ -873,100 +922,20 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
             // test argument (label to find)
             if (valueType[0] != value_isStringPointer) { return result_arg_stringExpected; }    // label to look for must be a string
             if (args[0].pStringConst == nullptr) { return result_arg_nonEmptyStringExpected; }  // label to look for must be a non-empty string
+            if (strnlen(args[0].pStringConst, MAX_BATCH_LABEL_LEN + 1) > MAX_BATCH_LABEL_LEN) { return result_arg_outsideRange; }    // longer labels are not indexed
 
-            // prepare a string with the label to find, followed by two ending colons (::) - the starting slashes (//) are not included
-            int labelLength = 2 + strlen(args[0].pStringConst) + 2;                             // excluding terminating '\0'
-            char label[labelLength + 1];
-            strcpy(label, args[0].pStringConst);
-            strcat(label, "::");
-
-            // state machine: while reading the file, keep track of the current reading state (within string, within comment, ...)
-            textState state{ lineStart };                                                       // currently at the start of a line
-            bool flag_isLabelCandidate{ true };                                                 // a label is still possible, based on last characters read
-            bool labelFound{ false };
-
+            // find the label in the label index of the batch file (built when the first 'gotoLabel' command for this batch file is executed) 
+            // note that the label index is built by reading the batch file completely (in extreme cases, this could take a while for very long batch files)
             int streamNumber = _activeFunctionData.statementInputStream;                        // stream assigned to the currently executing batch file
-            File* pfile = &openFiles[streamNumber - 1].file;                                    // file number = stream number -1
-            pfile->seek(0);                                                                     // go to beginning of file
-
-            // find specified label in the batch file, starting from BOF
-            // ---------------------------------------------------------
-            // note that we cannot simply look for the label using pfile->find(...), because the label character pattern ("//...::") could be part of a single- or multi-line comment or a string
-
-            while (pfile->available())
-            {
-                bool exitNow{ false };
-                char c = pfile->read();
-
-                switch (state) {
-                    case defaultState:                                          // not within a comment or string, not at line start either (somewhere within a line)
-                    case lineStart:                                             // the first character of a line is next to read
-                    {
-                        flag_isLabelCandidate = (state == defaultState) ? (c == '\n') : (c == '/');     // label is possible ? (depending on next characters)
-                        if (c == '\"') { state = withinString; break; }         // quote: start of a string
-                        if (c == '/') { state = afterFirstCommentSlash; break; }// slash: start of a comment
-                        if (c == '\n') { state = lineStart; break; }            // back at line start
-                        state = defaultState;                                   // now somewhere within a line, but not at line start and not within a comment or a string
-                    }
-                    break;
-
-                    case withinString:
-                    {
-                        flag_isLabelCandidate = (c == '\n');                    // label is possible ? (depending on next characters)
-                        if (c == '\\') { state = stringEscCharRead; break; }    // backslash: start of a 2-character string escape sequence
-                        if (c == '\"') { state = defaultState; break; }         // quote (and not within an escape sequence): end string
-                        if (c == '\n') { state = lineStart; break; }            // the string does not have an ending quote (note: parsing this line will lead to a parsing error)
-                        // if other character, then state doesn't change (within a string)
-                    }
-                    break;
-
-                    case stringEscCharRead:
-                    {
-                        // note: parsing this line will produce an error if c is not one of these four characters: r,n,\ or " (completing the escape sequence)
-                        flag_isLabelCandidate = (c == '\n');                    // (c: 0x0a, NOT 'n') the backslash is the last character on that source line ?
-                        if (c == '\n') { state = lineStart; break; }            // the string does not have an ending quote(note: parsing this line will lead to a parsing error)
-                        state = withinString;
-                    }
-                    break;
-
-                    case afterFirstCommentSlash:                                // after the slash of what could become a comment start sequence ('//' or '/*')
-                    {
-                        if (c == '/') {                                         // second slash: single-line comment
-                            if (flag_isLabelCandidate) {                        // preceded by newline and slash
-                                unsigned long position = pfile->position();     // remember file position
-                                if (!pfile->findUntil(label, "\n")) { state = lineStart; break; }   // line end ('\n') was found before the label: at the start of a line now (continue searching)
-                                if ((pfile->position() - position) != strlen(label)) {  // label did not start right after '//'
-                                    pfile->find('\n'); state = lineStart; break;        //  go to next line and continue the search
-                                }
-                                pfile->find('\n');  labelFound = exitNow = true; break; // label is FOUND (exit)
-                            }
-                            else { pfile->find("\n"); flag_isLabelCandidate = true; state = lineStart; break; }    // go to next line to continue the search
-                        }
-
-                        if (c == '*') {
-                            flag_isLabelCandidate = false;                      // label is not possible within a multi-line comment
-                            if (!pfile->find("*" "/")) { exitNow = true; break; }  // the multi-line comment does not have an ending '*'+'/' sequence: the label is NOT FOUND (exit)
-                            state = defaultState; break;                        // now somewhere within a line
-                        }
-
-                        flag_isLabelCandidate = (c == '\n');                    // a new line is required to start looking for a label
-                        if (c == '\n') { state = lineStart; break; }            // back at line start
-                        state = defaultState;                                   // now somewhere within a line
-                    }
-                    break;
-                }
-
-                if (exitNow) { break; }                                         // flag_isLabelCandidate indicates whether a label is found or not
-
-                // handle kill, abort and stop requests (in extreme cases, the gotoLabel command could take a while for very long batch files)
-                bool kill{ false }, doAbort{ false }, stdConsDummy{ false };
-                execPeriodicHousekeeping(&kill, &doAbort);                      // get housekeeping flags
-                if (kill) { return EVENT_kill; }                                // kill request from caller ?
-                else if (doAbort) { forcedAbortRequest = true; break; }         // abort running code (program or immediate mode statements) ?
-            }
+            bool kill{ false };
+            BatchLabelIndex* pLabelIndex = getBatchLabelIndex(streamNumber, kill, forcedAbortRequest);
+            if (kill) { return EVENT_kill; }                                                    // kill request from caller ?
 
-            if (forcedAbortRequest) {}                                          // has priority over 'label not found' error
-            else if (!labelFound) { return result_IO_batchFileLabelNotFound; }  // label was not found ? error exit
+            uint32_t labelPosition{};
+            bool labelFound = (pLabelIndex != nullptr) ? findBatchLabel(*pLabelIndex, args[0].pStringConst, labelPosition) : false;
+            if (forcedAbortRequest) {}                                                          // has priority over 'label not found' error
+            else if (!labelFound) { return result_IO_batchFileLabelNotFound; }                  // label was not found ? error exit
+            else { openFiles[streamNumber - 1].file.seek(labelPosition); }                     // next line to parse: line after the label (file number = stream number)
 
 
             // end execution of the line containing the 'gotoLabel' command
@@ -1485,6 +1454,7 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
             }
 
             SD_closeAllFiles();
+            deleteBatchLabelIndexes();                                              // the SD card could be replaced
             _SDinitOK = false;
             SD.end();
 
@@ -1564,11 +1534,14 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                     if ((argIsArray[1]) && (valueType[1] != value_isStringPointer)) { return result_array_valueTypeIsFixed; }   // an array cannot change type: it needs to be string to receive result
                     if (checkForDefault && (valueType[1] != value_isStringPointer)) { return result_arg_stringExpected; }       // default supplied: it needs to be string
 
-                    char s[80] = "\r\n===== Input (\\c to cancel";                                                              // title static text
-                    char title[80 + MAX_ALPHA_CONST_LEN] = "";                                                                  // title static text + string contents of variable
-                    strcat(s, checkForDefault ? ", \\d for default = '%s') =====" : "): =====");
-                    sprintf(title, s, (args[1].pStringConst == nullptr) ? "" : args[1].pStringConst);
-                    printlnTo(0, title);
+                    // print the title in parts: the default (string contents of variable) can be as long as the max. string length
+                    printTo(0, "\r\n===== Input (\\c to cancel");
+                    if (checkForDefault) {
+                        printTo(0, ", \\d for default = '");
+                        printTo(0, (args[1].pStringConst == nullptr) ? "" : args[1].pStringConst);
+                        printlnTo(0, "') =====");
+                    }
+                    else { printlnTo(0, "): ====="); }
                 }
 
                 else {                                                                                                          // info command
@@ -1737,6 +1710,9 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
         case cmdcod_printToVar:         // print the argument list to the variable (scalar or array element) entered as first argument
         case cmdcod_printLineToVar:     // same, end with a CRLF sequence (carriage return line feed)
 
+        case cmdcod_printToBuf:         // append the argument list to the string buffer entered as first argument (no intermediate strings are created)
+        case cmdcod_printLineToBuf:     // same, end with a CRLF sequence (carriage return line feed)
+
         // --------------------------------------------------------------------------------------------------------------------------------------------------------------
         // Print a list of arguments (longs, floats and strings) to a specific output stream or to a variable. End with a CRLF sequence (carriage return line feed).
         // These commands print a comma separated list that can later be parsed again into separate variables (with functions cinList(), readList() and vreadList() ). 
@@ -1748,6 +1724,7 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
         case cmdcod_coutList:           // print the argument list to the console
         case cmdcod_printList:          // print the argument list to the output stream specified by the first argument (external IO or open file)
         case cmdcod_printListToVar:     // print the argument list to the variable (scalar or array element) entered as first argument
+        case cmdcod_printListToBuf:     // append the argument list to the string buffer entered as first argument
 
         {
             // print to console, file or string ?
@@ -1755,21 +1732,23 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                 || (_activeFunctionData.activeCmd_commandCode == cmdcod_printList));
             bool isPrintToVar = ((_activeFunctionData.activeCmd_commandCode == cmdcod_printToVar) || (_activeFunctionData.activeCmd_commandCode == cmdcod_printLineToVar)
                 || (_activeFunctionData.activeCmd_commandCode == cmdcod_printListToVar));
+            bool isPrintToBuffer = ((_activeFunctionData.activeCmd_commandCode == cmdcod_printToBuf) || (_activeFunctionData.activeCmd_commandCode == cmdcod_printLineToBuf)
+                || (_activeFunctionData.activeCmd_commandCode == cmdcod_printListToBuf));
             bool isConsolePrint = ((_activeFunctionData.activeCmd_commandCode == cmdcod_cout) || (_activeFunctionData.activeCmd_commandCode == cmdcod_coutLine)
                 || (_activeFunctionData.activeCmd_commandCode == cmdcod_coutList));                                         // for now, refers to 'cout...' commands (implicit console reference)
             bool isDebugPrint = ((_activeFunctionData.activeCmd_commandCode == cmdcod_dbout) || (_activeFunctionData.activeCmd_commandCode == cmdcod_dboutLine));
-            int firstValueIndex = (isConsolePrint || isDebugPrint) ? 1 : 2;                                                 // print to file or string: first argument is file or string
+            int firstValueIndex = (isConsolePrint || isDebugPrint) ? 1 : 2;                                                 // print to file, string or string buffer: first argument is file, string or string buffer
 
             // normal or list print ?
             bool doPrintList = ((_activeFunctionData.activeCmd_commandCode == cmdcod_coutList) || (_activeFunctionData.activeCmd_commandCode == cmdcod_printList)
-                || (_activeFunctionData.activeCmd_commandCode == cmdcod_printListToVar));
+                || (_activeFunctionData.activeCmd_commandCode == cmdcod_printListToVar) || (_activeFunctionData.activeCmd_commandCode == cmdcod_printListToBuf));
 
             // print new line sequence ?
             bool doPrintLineEnd = ((_activeFunctionData.activeCmd_commandCode == cmdcod_dboutLine)
                 || (_activeFunctionData.activeCmd_commandCode == cmdcod_coutLine) || (_activeFunctionData.activeCmd_commandCode == cmdcod_printLine)
-                || (_activeFunctionData.activeCmd_commandCode == cmdcod_printLineToVar)
+                || (_activeFunctionData.activeCmd_commandCode == cmdcod_printLineToVar) || (_activeFunctionData.activeCmd_commandCode == cmdcod_printLineToBuf)
                 || (_activeFunctionData.activeCmd_commandCode == cmdcod_coutList) || (_activeFunctionData.activeCmd_commandCode == cmdcod_printList)
-                || (_activeFunctionData.activeCmd_commandCode == cmdcod_printListToVar));
+                || (_activeFunctionData.activeCmd_commandCode == cmdcod_printListToVar) || (_activeFunctionData.activeCmd_commandCode == cmdcod_printListToBuf));
 
             if (!(isDebugPrint && !_withUserDebug)) {
 
@@ -1786,6 +1765,7 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                 int* pStreamPrintColumn = _pLastPrintColumn;                                                                    // init (OK if no stream number provided)
                 int varPrintColumn{ 0 };                                                                                        // only for printing to string variable: current print column
                 char* assembledString{ nullptr };                                                                               // only for printing to string variable: intermediate string
+                StringBuffer* pStringBuffer{ nullptr };                                                                         // only for printing to string buffer
 
                 char intFmtStr[10] = "%#.*l";
                 strcat(intFmtStr, doPrintList ? "d" : _dispIntegerSpecifier);
@@ -1815,6 +1795,14 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                             *pStreamPrintColumn = 0;    // reset each time a new print to variable command is executed, because each time you start with an empty string variable
                         }
 
+                        else if (isPrintToBuffer) {     // append to string buffer: print column continues where the previous append ended
+                            if ((!opIsLong) && (!opIsFloat)) { return result_arg_numberExpected; }                              // string buffer number
+                            int bufferNumber = opIsLong ? operand.longConst : operand.floatConst;
+                            if ((bufferNumber < 1) || (bufferNumber > MAX_STRING_BUFFERS)) { return result_arg_outsideRange; }
+                            pStringBuffer = _stringBuffers + bufferNumber - 1;
+                            pStreamPrintColumn = &pStringBuffer->printColumn;
+                        }
+
                         else {     // print to given stream number
                             // check stream number (if file, also perform related file and SD card object checks)
                             if ((!opIsLong) && (!opIsFloat)) { return result_arg_numberExpected; }                              // file number
@@ -1926,6 +1914,11 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                             }
                         }
 
+                        else if (isPrintToBuffer) {        // append to string buffer, in place (print column is maintained as well)
+                            if (printString != nullptr) { execResult = appendToStringBuffer(pStringBuffer, printString, strlen(printString)); }
+                            if ((execResult == result_exec_OK) && doPrintList && (i < cmdArgCount)) { execResult = appendToStringBuffer(pStringBuffer, argSep, strlen(argSep)); }
+                        }
+
                         else {      // print to external stream, file or console ?
                             if (printString != nullptr) {
                                 // if a direct argument of a print function ENDS with CR or LF, reset print column to 0
@@ -1945,6 +1938,7 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                             _intermediateStringObjectCount--;
                             delete[] printString;
                         }
+                        if (execResult != result_exec_OK) { return execResult; }                                                 // string buffer full
                     }
 
                     pStackLvl = (LE_evalStack*)evalStack.getNextListElement(pStackLvl);
@@ -1983,19 +1977,13 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                     }
 
                     // save new string in variable 
-                    *pFirstArgStackLvl->varOrConst.value.ppStringConst = assembledString;                                       // init: copy pointer (OK if string length not above limit)
+                    *pFirstArgStackLvl->varOrConst.value.ppStringConst = assembledString;                                       // copy pointer (string is clipped in place below)
                     *pFirstArgStackLvl->varOrConst.varTypeAddress = (*pFirstArgStackLvl->varOrConst.varTypeAddress & ~value_typeMask) | value_isStringPointer;
 
-                    // string stored in variable: clip to maximum length
-                    if (strlen(assembledString) > MAX_ALPHA_CONST_LEN) {
-                        _systemStringObjectCount++;
-                        char* clippedString = new char[MAX_ALPHA_CONST_LEN];
-                        memcpy(clippedString, assembledString, MAX_ALPHA_CONST_LEN);                                            // copy the string, not the pointer
-                        clippedString[MAX_ALPHA_CONST_LEN] = '\0';
-                        *pFirstArgStackLvl->varOrConst.value.ppStringConst = clippedString;
-                    }
-
                     if (assembledString != nullptr) {
+                        // string stored in variable: clip to maximum length. Clip in place: the object itself becomes the variable string (no need to scan beyond the limit)
+                        if (strnlen(assembledString, MAX_ALPHA_CONST_LEN + 1) > MAX_ALPHA_CONST_LEN) { assembledString[MAX_ALPHA_CONST_LEN] = '\0'; }
+
                         // non-empty string, adapt object counters (change from intermediate to variable string)
                         _intermediateStringObjectCount--;        // but do not delete the object: it became a variable string
                         char varScope = (pFirstArgStackLvl->varOrConst.sourceVarScopeAndFlags & var_scopeMask);
@@ -2010,10 +1998,11 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                         _pDebugOut->print("  cmd: coutList (8) "); _pDebugOut->println(*pFirstArgStackLvl->varOrConst.value.ppStringConst);
                     #endif              
                     }
+                }
 
-                    if (strlen(assembledString) > MAX_ALPHA_CONST_LEN) {
-                        delete[] assembledString;                             // not referenced in eval. stack (clippedString is), so will not be deleted as part of cleanup
-                        _systemStringObjectCount--;
+                else if (isPrintToBuffer) {
+                    if (doPrintLineEnd) {                                                                                       // print column is reset to 0
+                        execResult = appendToStringBuffer(pStringBuffer, "\r\n", 2); if (execResult != result_exec_OK) { return execResult; }
                     }
                 }
 
@@ -2032,6 +2021,53 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
         break;
 
 
+        // ---------------------------------------------------------------------------------------------------------------------
+        // Flush a string buffer: print its contents to the output stream specified by the second argument and empty the buffer.
+        // If no stream is specified, the buffer contents are printed to the console. The buffer memory is kept for reuse.
+        // Clear a string buffer: empty the buffer and release its memory.
+        // ---------------------------------------------------------------------------------------------------------------------
+
+        case cmdcod_flushBuf:
+        case cmdcod_clearBuf:
+        {
+            bool argIsVar[2];
+            bool argIsArray[2];
+            char valueType[2];
+            Val args[2];
+            copyValueArgsFromStack(pStackLvl, cmdArgCount, argIsVar, argIsArray, valueType, args);
+
+            for (int i = 0; i < cmdArgCount; i++) {                                                                         // string buffer number, stream number
+                if ((valueType[i] != value_isLong) && (valueType[i] != value_isFloat)) { return result_arg_numberExpected; }
+                if (valueType[i] == value_isFloat) { args[i].longConst = args[i].floatConst; }
+            }
+            if ((args[0].longConst < 1) || (args[0].longConst > MAX_STRING_BUFFERS)) { return result_arg_outsideRange; }
+            StringBuffer* pStringBuffer = _stringBuffers + args[0].longConst - 1;
+
+            if (_activeFunctionData.activeCmd_commandCode == cmdcod_clearBuf) { deleteStringBuffer(pStringBuffer); }
+            else {
+                int streamNumber = (cmdArgCount == 2) ? args[1].longConst : 0;                                              // default: console
+                Stream* p{};
+                execResult = setActiveStreamTo(streamNumber, p, true); if (execResult != result_exec_OK) { return execResult; }   // perform checks and set output stream
+                int* pStreamPrintColumn = (streamNumber == 0) ? _pConsolePrintColumn :
+                    (streamNumber < 0) ? _pExternPrintColumns + (-streamNumber) - 1 : &(openFiles[streamNumber - 1].currentPrintColumn);
+
+                // print the buffer contents in one go. If a line end was appended to the buffer, the buffer print column is the new stream print column
+                if (pStringBuffer->length > 0) {
+                    print(pStringBuffer->pChars);
+                    *pStreamPrintColumn = (pStringBuffer->printColumn < pStringBuffer->length) ? pStringBuffer->printColumn : *pStreamPrintColumn + pStringBuffer->length;
+                    pStringBuffer->length = 0;                                                                              // empty the buffer, but keep the memory
+                    pStringBuffer->pChars[0] = '\0';
+                    pStringBuffer->printColumn = 0;
+                }
+            }
+
+            // clean up
+            clearEvalStackLevels(cmdArgCount);                                                                              // clear evaluation stack and intermediate strings 
+            _activeFunctionData.activeCmd_commandCode = cmdcod_none;                                                        // command execution ended
+        }
+        break;
+
+
         // ---------------------------------------------------------------------------------------------------------------------------------------
         // Print a list of all variables (global and user), print the call stack, a list of all breakpoints with attributes or a list of SD files.
         // The optional argument sets the output stream (external IO or open file).
@@ -2041,8 +2077,13 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
         case cmdcod_printVars:
         case cmdcod_printCallSt:
         case cmdcod_printBP:
+        case cmdcod_printProfile:
+        case cmdcod_traceDump:
         case cmdcod_listFiles:
         {
+            if ((_activeFunctionData.activeCmd_commandCode == cmdcod_printProfile) && (_pProfileFunctions == nullptr)) { return result_profilerNotAvailable; }
+            if ((_activeFunctionData.activeCmd_commandCode == cmdcod_traceDump) && (_pTraceEvents == nullptr)) { return result_tracerNotAvailable; }
+
             bool isConsolePrint{ true };                                                                                    // init
             int streamNumber = 0;                                                                                           // init: console
             execResult = setActiveStreamTo(streamNumber, true); if (execResult != result_exec_OK) { return execResult; }    // perform checks and set output stream
@@ -2069,7 +2110,9 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
                 *pStreamPrintColumn = 0;                                                                                    // will not be used here, but must be set to zero
             }
 
-            println();
+            bool printAsCSV = (_activeFunctionData.activeCmd_commandCode == cmdcod_printProfile) && (streamNumber > 0);    // profile to SD file: CSV format
+            bool printAsData = printAsCSV || (_activeFunctionData.activeCmd_commandCode == cmdcod_traceDump);                // no empty lines around CSV or JSON data
+            if (!printAsData) { println(); }
 
             if (_activeFunctionData.activeCmd_commandCode == cmdcod_printVars) {
                 printVariables(true);                                                                                       // print user variables
@@ -2080,12 +2123,16 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
 
             else if (_activeFunctionData.activeCmd_commandCode == cmdcod_printBP) { _pBreakpoints->printBreakpoints(); }
 
+            else if (_activeFunctionData.activeCmd_commandCode == cmdcod_printProfile) { printProfile(printAsCSV); }
+
+            else if (_activeFunctionData.activeCmd_commandCode == cmdcod_traceDump) { printTrace(); }
+
             else {
                 execResult = SD_listFiles();
                 if (execResult != result_exec_OK) { return execResult; };
             }
 
-            println();
+            if (!printAsData) { println(); }
             *pStreamPrintColumn = 0;
 
             // clean up
@@ -2544,7 +2591,8 @@ Justina::execResult_type Justina::execInternalCommand(bool& isFunctionReturn, bo
 
             // NOT a void Justina function  -AND-  RETURN statement without expression, or END statement: return a zero
             bool isVoidFunctionDef = (justinaFunctionData[_activeFunctionData.functionIndex].isVoidFunctionDef == 1);
-            terminateJustinaFunction(isVoidFunctionDef, !isVoidFunctionDef && (cmdArgCount == 0));                          // return statement (non-void function) has a return value ? 
+            execResult = terminateJustinaFunction(isVoidFunctionDef, !isVoidFunctionDef && (cmdArgCount == 0));             // return statement (non-void function) has a return value ? 
+            if (execResult != result_exec_OK) { return execResult; }
             execResult = isVoidFunctionDef ? result_exec_OK : execAllProcessedOperators();
             if (execResult != result_exec_OK) { return execResult; }
 
@@ -156,7 +156,11 @@ Justina::execResult_type Justina::SD_open(int& fileNumber, const char* filePath,
         }
     }
 
+    // file can be changed now: a label index kept for it (batch file) is not valid any more
+    if (mode & (WRITE_FILE | APPEND_FILE)) { deleteBatchLabelIndex(openFiles[fileNumber - 1].filePath); }
+
     _openFileCount++;
+    if (_tracingOn) { traceEvent(trace_SDfile, 'B', fileNumber); }
 
     return result_exec_OK;
 }
@@ -227,6 +231,10 @@ Justina::execResult_type Justina::SD_openNext(int dirFileNumber, int& fileNumber
         }
     }
 
+    // file can be changed now: a label index kept for it (batch file) is not valid any more
+    if (mode & (WRITE_FILE | APPEND_FILE)) { deleteBatchLabelIndex(openFiles[fileNumber - 1].filePath); }
+
+    if (_tracingOn) { traceEvent(trace_SDfile, 'B', fileNumber); }
     return result_exec_OK;
 }
 
@@ -240,6 +248,9 @@ void Justina::SD_closeFile(int fileNumber) {
     // checks MUST have been done before calling this function
     if (openFiles[fileNumber - 1].fileNumberInUse == 0) { return; }       // safety
 
+    deleteBatchLineCache(fileNumber);                                       // parsed batch file lines are only valid while the file is open
+    if (_tracingOn) { traceEvent(trace_SDfile, 'E', fileNumber); }
+
     if (static_cast <Stream*>(&openFiles[fileNumber - 1].file) == static_cast <Stream*>(_pDebugOut)) { _pDebugOut = _pConsoleOut; }
 
     _openFileCount--;
@@ -288,6 +299,9 @@ void  Justina::SD_closeAllFiles(bool includeSystemFiles) {     // close all open
                 _pDebugOut = _pConsoleOut;
             }
 
+            deleteBatchLineCache(stream + 1);                                                                                       // parsed batch file lines are only valid while the file is open
+            if (_tracingOn) { traceEvent(trace_SDfile, 'E', stream + 1); }
+
             delete[] openFiles[stream].filePath;  // (never an empty string)
             _systemStringObjectCount--;
 
@@ -323,6 +337,369 @@ void  Justina::SD_closeAllFiles(bool includeSystemFiles) {     // close all open
 }
 
 
+// -------------------------------------------------------------------------------------------
+// *   'gotoLabel' command: get the label index of an open batch file (build it if needed)   *
+// -------------------------------------------------------------------------------------------
+
+// the label index of a batch file is built the first time a 'gotoLabel' command is executed for it, and it is kept when the batch file is closed...
+// ...until the SD card is stopped or the machine is reset including user variables
+// it is deleted when the file is opened for writing (the file could be changed without changing its size)...
+// ...and it is built again if the batch file is reopened with a different size (safety net)
+// returns nullptr if building the index was interrupted (kill or abort request)
+
+Justina::BatchLabelIndex* Justina::getBatchLabelIndex(int fileNumber, bool& kill, bool& forcedAbortRequest) {
+    File* pFile = &openFiles[fileNumber - 1].file;
+    char* filePath = openFiles[fileNumber - 1].filePath;
+    _batchLabelIndexUseCount++;
+
+    // find label index for this batch file; if not found, replace an entry not in use or the least recently used entry
+    int entryIndex = 0;
+    for (int i = 0; i < MAX_OPEN_SD_FILES; i++) {
+        if (_batchLabelIndexes[i].filePath == nullptr) { entryIndex = i; continue; }                                    // entry not in use: keep looking for this batch file
+        if (strcmp(_batchLabelIndexes[i].filePath, filePath) == 0) { entryIndex = i; break; }
+        if ((_batchLabelIndexes[entryIndex].filePath != nullptr) && (_batchLabelIndexes[i].lastUsed < _batchLabelIndexes[entryIndex].lastUsed)) { entryIndex = i; }
+    }
+    BatchLabelIndex& labelIndex = _batchLabelIndexes[entryIndex];
+
+    bool isIndexForFile = (labelIndex.filePath != nullptr) ? (strcmp(labelIndex.filePath, filePath) == 0) : false;
+    if (!isIndexForFile || (labelIndex.fileSize != pFile->size())) {
+        if (!buildBatchLabelIndex(fileNumber, labelIndex, kill, forcedAbortRequest)) { return nullptr; }
+    }
+    labelIndex.lastUsed = _batchLabelIndexUseCount;
+    return &labelIndex;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// *   build the label index of a batch file: read the complete batch file and store the file position of each label   *
+// ---------------------------------------------------------------------------------------------------------------------
+
+/* ----------------------------------------------------------------------------------------------------------------------------------------------------------
+    A label is defined as the first part of a single-line comment, which must start at the beginning of a line. It is terminated by two colons (':'), followed by an optional comment.
+    The stored file position is the position of the line following the label. If a label occurs more than once, the first occurrence is kept.
+    Note that we cannot simply look for labels using pfile->find(...), because the label character pattern ("//...::") could be part of a single- or multi-line comment or a string
+---------------------------------------------------------------------------------------------------------------------------------------------------------- */
+
+bool Justina::buildBatchLabelIndex(int fileNumber, BatchLabelIndex& labelIndex, bool& kill, bool& forcedAbortRequest) {
+
+    // temporary label index: replaces the index entry only if the complete batch file was read
+    BatchLabelIndex newIndex{};
+    int labelsCapacity{ 0 };
+
+    // state machine: while reading the file, keep track of the current reading state (within string, within comment, ...)
+    textState state{ lineStart };                                                       // currently at the start of a line
+    bool flag_isLabelCandidate{ true };                                                 // a label is still possible, based on last characters read
+    char label[MAX_BATCH_LABEL_LEN + 2 + 1];                                            // label, ending colons and terminating '\0'
+    uint32_t labelPosition{};
+
+    File* pFile = &openFiles[fileNumber - 1].file;
+    pFile->seek(0);                                                                     // go to beginning of file
+
+    while (pFile->available())
+    {
+        bool exitNow{ false };
+        char c = pFile->read();
+
+        switch (state) {
+            case defaultState:                                          // not within a comment or string, not at line start either (somewhere within a line)
+            case lineStart:                                             // the first character of a line is next to read
+            {
+                flag_isLabelCandidate = (state == defaultState) ? (c == '\n') : (c == '/');     // label is possible ? (depending on next characters)
+                if (c == '\"') { state = withinString; break; }         // quote: start of a string
+                if (c == '/') { state = afterFirstCommentSlash; break; }// slash: start of a comment
+                if (c == '\n') { state = lineStart; break; }            // back at line start
+                state = defaultState;                                   // now somewhere within a line, but not at line start and not within a comment or a string
+            }
+            break;
+
+            case withinString:
+            {
+                flag_isLabelCandidate = (c == '\n');                    // label is possible ? (depending on next characters)
+                if (c == '\\') { state = stringEscCharRead; break; }    // backslash: start of a 2-character string escape sequence
+                if (c == '\"') { state = defaultState; break; }         // quote (and not within an escape sequence): end string
+                if (c == '\n') { state = lineStart; break; }            // the string does not have an ending quote (note: parsing this line will lead to a parsing error)
+                // if other character, then state doesn't change (within a string)
+            }
+            break;
+
+            case stringEscCharRead:
+            {
+                // note: parsing this line will produce an error if c is not one of these four characters: r,n,\ or " (completing the escape sequence)
+                flag_isLabelCandidate = (c == '\n');                    // (c: 0x0a, NOT 'n') the backslash is the last character on that source line ?
+                if (c == '\n') { state = lineStart; break; }            // the string does not have an ending quote(note: parsing this line will lead to a parsing error)
+                state = withinString;
+            }
+            break;
+
+            case afterFirstCommentSlash:                                // after the slash of what could become a comment start sequence ('//' or '/*')
+            {
+                if (c == '/') {                                         // second slash: single-line comment
+                    if (flag_isLabelCandidate) {                        // preceded by newline and slash: read label (if any) up to the ending colons
+                        int labelLength{ 0 };
+                        bool isLabel{ false };
+                        while (pFile->available()) {
+                            char l = pFile->read();
+                            if (l == '\n') { break; }                                                       // line end: not a label
+                            if (labelLength == MAX_BATCH_LABEL_LEN + 2) { pFile->find('\n'); break; }       // too long for a label
+                            label[labelLength++] = l;
+                            if ((labelLength >= 2) && (label[labelLength - 2] == ':') && (label[labelLength - 1] == ':')) { isLabel = true; break; }
+                        }
+                        if (isLabel) {
+                            label[labelLength - 2] = '\0';                                                  // remove ending colons
+                            pFile->find('\n');                                                              // the label position is the start of the next line
+                            bool isNewLabel = (label[0] != '\0') && !findBatchLabel(newIndex, label, labelPosition);   // first occurrence of a label only
+                            if (isNewLabel) { addBatchLabel(newIndex, labelsCapacity, label, pFile->position()); }
+                        }
+                    }
+                    else { pFile->find("\n"); }                         // go to next line to continue the search
+                    flag_isLabelCandidate = true; state = lineStart; break;
+                }
+
+                if (c == '*') {
+                    flag_isLabelCandidate = false;                      // label is not possible within a multi-line comment
+                    if (!pFile->find("*" "/")) { exitNow = true; break; }  // the multi-line comment does not have an ending '*'+'/' sequence: no more labels (exit)
+                    state = defaultState; break;                        // now somewhere within a line
+                }
+
+                flag_isLabelCandidate = (c == '\n');                    // a new line is required to start looking for a label
+                if (c == '\n') { state = lineStart; break; }            // back at line start
+                state = defaultState;                                   // now somewhere within a line
+            }
+            break;
+        }
+
+        if (exitNow) { break; }
+
+        // handle kill, abort and stop requests (in extreme cases, reading the batch file could take a while for very long batch files)
+        bool doAbort{ false };
+        execPeriodicHousekeeping(&kill, &doAbort);                      // get housekeeping flags
+        if (kill || doAbort) {                                          // kill request from caller, or abort running code ? label index is incomplete: discard
+            forcedAbortRequest = doAbort;
+            if (newIndex.pLabels != nullptr) { _systemStringObjectCount--; delete[] newIndex.pLabels; }
+            return false;
+        }
+    }
+
+    // replace label index entry (delete the previous label index, if any)
+    if (labelIndex.pLabels != nullptr) { _systemStringObjectCount--; delete[] labelIndex.pLabels; }
+    if (labelIndex.filePath != nullptr) { _systemStringObjectCount--; delete[] labelIndex.filePath; }
+
+    newIndex.filePath = new char[strlen(openFiles[fileNumber - 1].filePath) + 1];
+    _systemStringObjectCount++;
+    strcpy(newIndex.filePath, openFiles[fileNumber - 1].filePath);
+    newIndex.fileSize = pFile->size();
+    labelIndex = newIndex;
+    return true;
+}
+
+
+// ----------------------------------------------------------------
+// *   add a label and its file position to a batch label index   *
+// ----------------------------------------------------------------
+
+void Justina::addBatchLabel(BatchLabelIndex& labelIndex, int& labelsCapacity, const char* label, uint32_t position) {
+    int labelSize = sizeof(uint32_t) + strlen(label) + 1;
+
+    // no room for this label ? create a larger label storage area (double size) and move labels already stored 
+    if (labelIndex.labelsSize + labelSize > labelsCapacity) {
+        labelsCapacity = max(2 * labelsCapacity, labelIndex.labelsSize + labelSize);
+        char* pLabels = new char[labelsCapacity];
+        if (labelIndex.pLabels != nullptr) {
+            memcpy(pLabels, labelIndex.pLabels, labelIndex.labelsSize);
+            delete[] labelIndex.pLabels;
+        }
+        else { _systemStringObjectCount++; }
+        labelIndex.pLabels = pLabels;
+    }
+
+    char* pLabel = labelIndex.pLabels + labelIndex.labelsSize;
+    memcpy(pLabel, &position, sizeof(uint32_t));                                        // not aligned: copy memory
+    strcpy(pLabel + sizeof(uint32_t), label);
+    labelIndex.labelsSize += labelSize;
+}
+
+
+// --------------------------------------------------------------------------------
+// *   find a label in a batch label index and return the position of next line   *
+// --------------------------------------------------------------------------------
+
+bool Justina::findBatchLabel(BatchLabelIndex& labelIndex, const char* label, uint32_t& position) {
+    char* pLabel = labelIndex.pLabels;
+    while (pLabel < labelIndex.pLabels + labelIndex.labelsSize) {
+        if (strcmp(pLabel + sizeof(uint32_t), label) == 0) { memcpy(&position, pLabel, sizeof(uint32_t)); return true; }
+        pLabel += sizeof(uint32_t) + strlen(pLabel + sizeof(uint32_t)) + 1;
+    }
+    return false;
+}
+
+
+// -------------------------------------------------------------
+// *   delete the label index of a batch file (if available)   *
+// -------------------------------------------------------------
+
+void Justina::deleteBatchLabelIndex(const char* filePath) {
+    for (int i = 0; i < MAX_OPEN_SD_FILES; i++) {
+        BatchLabelIndex& labelIndex = _batchLabelIndexes[i];
+        if (labelIndex.filePath == nullptr) { continue; }
+        if (strcasecmp(labelIndex.filePath, filePath) != 0) { continue; }                                                 // 8.3 file format: NOT case sensitive
+        if (labelIndex.pLabels != nullptr) { _systemStringObjectCount--; delete[] labelIndex.pLabels; }
+        _systemStringObjectCount--;
+        delete[] labelIndex.filePath;
+        labelIndex = BatchLabelIndex{};
+    }
+}
+
+
+// -------------------------------------------------
+// *   delete the label index of all batch files   *
+// -------------------------------------------------
+
+void Justina::deleteBatchLabelIndexes() {
+    for (int i = 0; i < MAX_OPEN_SD_FILES; i++) {
+        BatchLabelIndex& labelIndex = _batchLabelIndexes[i];
+        if (labelIndex.pLabels != nullptr) { _systemStringObjectCount--; delete[] labelIndex.pLabels; }
+        if (labelIndex.filePath != nullptr) { _systemStringObjectCount--; delete[] labelIndex.filePath; }
+        labelIndex = BatchLabelIndex{};
+    }
+}
+
+
+// ----------------------------------------------------------------------------------------------------------
+// *   batch line cache: copy the parsed statements of a batch file line to immediate mode program memory   *
+// ----------------------------------------------------------------------------------------------------------
+
+/* ----------------------------------------------------------------------------------------------------------------------------------------------------------
+    Each batch file line is read and parsed as a command line. While a batch file is open, lines parsed without errors are kept for reuse (within the byte budget
+    MAX_BATCH_LINE_CACHE_SIZE for all open batch files), with the file position of the line start as key. This avoids reading and parsing a line again when
+    it is executed again (lines following a label that is jumped to with the 'gotoLabel' command).
+    Lines are normally executed in file order: look-up starts at the line following the line last found or stored.
+    Returns false if the line is not found in the cache. If found, the program counter is set as if the line was parsed just now, and the file position is set
+    to the start of the next line.
+---------------------------------------------------------------------------------------------------------------------------------------------------------- */
+
+bool Justina::getBatchLineCacheEntry(int fileNumber, uint32_t lineStart) {
+    BatchLineCache& lineCache = _batchLineCaches[fileNumber - 1];
+    BatchLineHeader lineHeader;
+
+    for (int pass = 1; pass <= 2; pass++) {                                                     // pass 1: from next look-up position to end, pass 2: from start to next look-up position
+        char* pLine = lineCache.pLines + ((pass == 1) ? lineCache.nextLookup : 0);
+        char* pLinesEnd = lineCache.pLines + ((pass == 1) ? lineCache.linesSize : lineCache.nextLookup);
+        while (pLine < pLinesEnd) {
+            memcpy(&lineHeader, pLine, sizeof(BatchLineHeader));                                // not necessarily aligned: copy memory
+            char* pNextLine = pLine + sizeof(BatchLineHeader) + lineHeader.tokenBytes;
+            if ((lineHeader.lineStart == lineStart) && (lineHeader.withinMultiLineCommentAtStart == _withinMultiLineComment)) {
+                // found: the copy in immediate mode program memory gets its own string constants (they are deleted when execution of the line ends)
+                memcpy(_programStorage + _PROGRAM_MEMORY_SIZE, pLine + sizeof(BatchLineHeader), lineHeader.tokenBytes);
+                copyConstStringObjects(_programStorage + _PROGRAM_MEMORY_SIZE);
+                _programCounter = _programStorage + _PROGRAM_MEMORY_SIZE + lineHeader.tokenBytes - 1;
+
+                openFiles[fileNumber - 1].file.seek(lineHeader.lineEnd);                        // skip the line in the batch file
+                _withinMultiLineComment = lineHeader.withinMultiLineCommentAtEnd;
+                lineCache.nextLookup = pNextLine - lineCache.pLines;
+                _batchLineCacheHits++;
+                return true;
+            }
+            pLine = pNextLine;
+        }
+    }
+
+    _batchLineCacheMisses++;
+    return false;
+}
+
+
+// -----------------------------------------------------------------------------------
+// *   batch line cache: keep a copy of the parsed statements of a batch file line   *
+// -----------------------------------------------------------------------------------
+
+// the batch file line was parsed without errors just now: parsed statements are in immediate mode program memory, up to the program counter
+// the file position is at the start of the next line. If the byte budget for all open batch files is exhausted, the line is not kept
+
+void Justina::storeBatchLineCacheEntry(int fileNumber, uint32_t lineStart, bool withinMultiLineCommentAtStart) {
+    BatchLineCache& lineCache = _batchLineCaches[fileNumber - 1];
+
+    // commands skipped during execution take action while parsing (e.g. creating a variable): do not keep a line containing such a command
+    char* pStep = _programStorage + _PROGRAM_MEMORY_SIZE;
+    while ((*pStep & 0x0F) != tok_no_token) {
+        if ((*pStep & 0x0F) == tok_isInternCommand) {
+            if (_internCommands[((Token_internalCommand*)pStep)->tokenIndex].usageRestrictions & cmd_skipDuringExec) { return; }
+        }
+        pStep += (_tokenDecodeTable[(uint8_t)*pStep] >> 8) & 0x0F;
+    }
+
+    BatchLineHeader lineHeader{ lineStart, (uint32_t)openFiles[fileNumber - 1].file.position(), withinMultiLineCommentAtStart, _withinMultiLineComment, 0 };
+    lineHeader.tokenBytes = _programCounter - (_programStorage + _PROGRAM_MEMORY_SIZE) + 1;    // including terminating 'no token'
+    int lineSize = sizeof(BatchLineHeader) + lineHeader.tokenBytes;
+
+    // not enough room for the line ? grow capacity geometrically, within the byte budget
+    if (lineCache.linesSize + lineSize > lineCache.linesCapacity) {
+        int newCapacity = max(lineCache.linesCapacity * 2, lineCache.linesSize + lineSize);
+        newCapacity = min(newCapacity, lineCache.linesCapacity + (MAX_BATCH_LINE_CACHE_SIZE - _batchLineCacheSize));
+        if (lineCache.linesSize + lineSize > newCapacity) { return; }                           // byte budget exhausted
+
+        char* pNewLines = new char[newCapacity];
+    #if PRINT_HEAP_OBJ_CREA_DEL
+        _pDebugOut->print("\r\n+++++ (system str ) "); _pDebugOut->println((uint32_t)pNewLines, HEX);
+    #endif
+        if (lineCache.pLines == nullptr) { _systemStringObjectCount++; }
+        else {
+            memcpy(pNewLines, lineCache.pLines, lineCache.linesSize);                          // string constants do not move
+        #if PRINT_HEAP_OBJ_CREA_DEL
+            _pDebugOut->print("\r\n----- (system str ) "); _pDebugOut->println((uint32_t)lineCache.pLines, HEX);
+        #endif
+            delete[] lineCache.pLines;
+        }
+        _batchLineCacheSize += newCapacity - lineCache.linesCapacity;
+        lineCache.pLines = pNewLines;
+        lineCache.linesCapacity = newCapacity;
+    }
+
+    char* pLine = lineCache.pLines + lineCache.linesSize;
+    memcpy(pLine, &lineHeader, sizeof(BatchLineHeader));
+    memcpy(pLine + sizeof(BatchLineHeader), _programStorage + _PROGRAM_MEMORY_SIZE, lineHeader.tokenBytes);
+    copyConstStringObjects(pLine + sizeof(BatchLineHeader));                                   // the cached parsed statements own their string constants
+    lineCache.linesSize += lineSize;
+    lineCache.nextLookup = lineCache.linesSize;
+}
+
+
+// -----------------------------------------------------------------
+// *   batch line cache: delete the parsed lines of a batch file   *
+// -----------------------------------------------------------------
+
+void Justina::deleteBatchLineCache(int fileNumber) {
+    BatchLineCache& lineCache = _batchLineCaches[fileNumber - 1];
+    if (lineCache.pLines == nullptr) { return; }                                                // nothing kept for this file
+
+    BatchLineHeader lineHeader;
+    char* pLine = lineCache.pLines;
+    while (pLine < lineCache.pLines + lineCache.linesSize) {
+        memcpy(&lineHeader, pLine, sizeof(BatchLineHeader));                                    // not necessarily aligned: copy memory
+        deleteConstStringObjects(pLine + sizeof(BatchLineHeader));                              // string constants owned by the cached parsed statements
+        pLine += sizeof(BatchLineHeader) + lineHeader.tokenBytes;
+    }
+
+#if PRINT_HEAP_OBJ_CREA_DEL
+    _pDebugOut->print("\r\n----- (system str ) "); _pDebugOut->println((uint32_t)lineCache.pLines, HEX);
+#endif
+    _systemStringObjectCount--;
+    delete[] lineCache.pLines;
+    _batchLineCacheSize -= lineCache.linesCapacity;
+    lineCache = BatchLineCache{};
+}
+
+
+// -------------------------------------------------------------------------------------------
+// *   batch line cache: delete the parsed lines of all open batch files (files stay open)   *
+// -------------------------------------------------------------------------------------------
+
+// parsed statements refer to variables and Justina functions by index
+
+void Justina::clearBatchLineCaches() {
+    for (int i = 1; i <= MAX_OPEN_SD_FILES; i++) { deleteBatchLineCache(i); }
+}
+
+
 // ---------------------------------------------------------------------------------------------------
 // *   list all files on SD card with date and size, to any output stream (even an SD file itself)   *
 // ---------------------------------------------------------------------------------------------------
@@ -1244,8 +1621,16 @@ void Justina::prettyPrintStatements(int outputStream, int instructionCount, char
     strcat(floatFmtStr, _dispFloatSpecifier);
 
     while (tokenType != tok_no_token) {                                                                                 // for all tokens in token list
-        int tokenLength = (tokenType >= tok_isTerminalGroup1) ? sizeof(Token_terminal) : (tokenType == tok_isConstant) ? sizeof(Token_constant) :
-            (tokenType == tok_isSymbolicConstant) ? sizeof(Token_symbolicConstant) : (*progCnt.pTokenChars >> 4) & 0x0F;
+        // folded constant ? print the original tokens of the folded operation instead (they follow the constant token and its end marker)
+        if (foldedConstantEnd(progCnt.pTokenChars) != nullptr) {
+            char* pOriginalTokens = progCnt.pTokenChars + sizeof(Token_constant) + sizeof(Token_terminalWithJump);
+            if (errorProgCounter == progCnt.pTokenChars) { errorProgCounter = pOriginalTokens; }
+            progCnt.pTokenChars = pOriginalTokens;
+            tokenType = *progCnt.pTokenChars & 0x0F;
+            continue;
+        }
+
+        int tokenLength = (_tokenDecodeTable[(uint8_t)*progCnt.pTokenChars] >> 8) & 0x0F;
         TokenPointer nextProgCnt;
         nextProgCnt.pTokenChars = progCnt.pTokenChars + tokenLength;
         int nextTokenType = *nextProgCnt.pTokenChars & 0x0F;                                                            // next token type (look ahead)
@@ -1419,8 +1804,8 @@ void Justina::prettyPrintStatements(int outputStream, int instructionCount, char
                     testNextForPostfix = false;
                 }
 
-                else if ((_terminals[index].terminalCode == termcod_comma) || (_terminals[index].terminalCode == termcod_semicolon) || (_terminals[index].terminalCode == termcod_semicolon_BPset)
-                    || (_terminals[index].terminalCode == termcod_semicolon_BPallowed)) {
+                else if ((_terminals[index].terminalCode == termcod_comma) || (_terminals[index].terminalCode == termcod_comma_lazyArg) || (_terminals[index].terminalCode == termcod_semicolon)
+                    || (_terminals[index].terminalCode == termcod_semicolon_BPset) || (_terminals[index].terminalCode == termcod_semicolon_BPallowed)) {
                     testNextForPostfix = false;
                     trailing[0] = ' ';                                                      // single space (already terminated by '\0')
                     hasTrailingSpace = true;
@@ -1815,10 +2200,21 @@ void  Justina::printToString(int width, int precision, bool inputIsString, bool
     int opStrLen{ 0 }, resultStrLen{ 0 };
 
     if (inputIsString) {
-        if ((*value).pStringConst != nullptr) {
-            opStrLen = strlen((*value).pStringConst);
-            if (opStrLen > MAX_PRINT_WIDTH) { (*value).pStringConst[MAX_PRINT_WIDTH] = '\0'; opStrLen = MAX_PRINT_WIDTH; }  // clip input string without warning (won't need it any more)
+        if (expandStrings) {
+            if ((*value).pStringConst != nullptr) {
+                char* pString = (*value).pStringConst;                                                                      // remember pointer to original string
+                quoteAndExpandEscSeq((*value).pStringConst);                                                                // creates new string
+            #if PRINT_HEAP_OBJ_CREA_DEL
+                _pDebugOut->print("\r\n----- (Intermd str) ");   _pDebugOut->println((uint32_t)pString, HEX);
+                _pDebugOut->print("  printToString (2) ");   _pDebugOut->println(pString);
+            #endif
+                _intermediateStringObjectCount--;
+                delete[] pString;                                               // delete old string
+            }
         }
+
+        // no more than 'precision' characters are printed: no need to scan the (expanded) string beyond that
+        if ((*value).pStringConst != nullptr) { opStrLen = strnlen((*value).pStringConst, precision); }
         resultStrLen = max(width + 10, opStrLen + 10);                                                                      // allow for a few extra formatting characters, if any
     }
     else {
@@ -1831,18 +2227,6 @@ void  Justina::printToString(int width, int precision, bool inputIsString, bool
     fcnResult.pStringConst = new char[resultStrLen + 1];
 
     if (inputIsString) {
-        if (expandStrings) {
-            if ((*value).pStringConst != nullptr) {
-                char* pString = (*value).pStringConst;                                                                      // remember pointer to original string
-                quoteAndExpandEscSeq((*value).pStringConst);                                                                // creates new string
-            #if PRINT_HEAP_OBJ_CREA_DEL
-                _pDebugOut->print("\r\n----- (Intermd str) ");   _pDebugOut->println((uint32_t)pString, HEX);
-                _pDebugOut->print("  printToString (2) ");   _pDebugOut->println(pString);
-            #endif
-                _intermediateStringObjectCount--;
-                delete[] pString;                                               // delete old string
-            }
-        }
         sprintf(fcnResult.pStringConst, fmtString, width, precision, ((*value).pStringConst == nullptr) ? (expandStrings ? "\"\"" : "") : (*value).pStringConst, &charsPrinted);
     }
     // note: hex output for floating point numbers is not provided (Arduino)
@@ -1862,3 +2246,61 @@ void  Justina::printToString(int width, int precision, bool inputIsString, bool
 }
 
 
+// ------------------------------------------------------
+// *   append characters to a string buffer, in place   *
+// ------------------------------------------------------
+
+// if the buffer would exceed its max. length, nothing is appended and an error is returned (buffer contents are kept)
+
+Justina::execResult_type Justina::appendToStringBuffer(StringBuffer* pBuffer, const char* s, int length) {
+    if (length <= 0) { return result_exec_OK; }
+    if (pBuffer->length + length > MAX_STRING_BUFFER_LEN) { return result_stringBufferFull; }
+
+    // buffer full ? at least double the capacity (up to the max. length): appending n characters in a loop then copies each character a constant number of times (on average)
+    if (pBuffer->length + length > pBuffer->capacity) {
+        int newCapacity = min(max(max(2 * pBuffer->capacity, pBuffer->length + length), MIN_STRING_BUFFER_CAPACITY), MAX_STRING_BUFFER_LEN);
+        char* pNewChars = new char[newCapacity + 1];
+    #if PRINT_HEAP_OBJ_CREA_DEL
+        _pDebugOut->print("\r\n+++++ (system str ) "); _pDebugOut->println((uint32_t)pNewChars, HEX);
+    #endif
+        if (pBuffer->pChars == nullptr) { _systemStringObjectCount++; }
+        else {
+            memcpy(pNewChars, pBuffer->pChars, pBuffer->length);
+        #if PRINT_HEAP_OBJ_CREA_DEL
+            _pDebugOut->print("\r\n----- (system str ) "); _pDebugOut->println((uint32_t)pBuffer->pChars, HEX);
+        #endif
+            delete[] pBuffer->pChars;
+        }
+        pBuffer->pChars = pNewChars;
+        pBuffer->capacity = newCapacity;
+    }
+
+    memcpy(pBuffer->pChars + pBuffer->length, s, length);
+    pBuffer->length += length;
+    pBuffer->pChars[pBuffer->length] = '\0';
+
+    // if the characters appended end with CR or LF, reset print column to 0 (same as for printing to a stream)
+    pBuffer->printColumn = ((s[length - 1] == '\r') || (s[length - 1] == '\n')) ? 0 : pBuffer->printColumn + length;
+    return result_exec_OK;
+}
+
+
+// ----------------------------------------------------
+// *   empty a string buffer and release its memory   *
+// ----------------------------------------------------
+
+void Justina::deleteStringBuffer(StringBuffer* pBuffer) {
+    if (pBuffer->pChars != nullptr) {
+    #if PRINT_HEAP_OBJ_CREA_DEL
+        _pDebugOut->print("\r\n----- (system str ) "); _pDebugOut->println((uint32_t)pBuffer->pChars, HEX);
+    #endif
+        _systemStringObjectCount--;
+        delete[] pBuffer->pChars;
+    }
+    pBuffer->pChars = nullptr;
+    pBuffer->length = 0;
+    pBuffer->capacity = 0;
+    pBuffer->printColumn = 0;
+}
+
+
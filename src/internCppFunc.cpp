@@ -1142,9 +1142,10 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
             // result is a non-empty string ? an object still has to be created on the heap
             if ((fcnResultValueType == value_isStringPointer) && (fcnResult.pStringConst != nullptr)) {
                 int resultIndex = match ? matchIndex + 1 : suppliedArgCount - 1;
+                int stringlen = strlen(args[resultIndex].pStringConst);
                 _intermediateStringObjectCount++;
-                fcnResult.pStringConst = new char[strlen(args[resultIndex].pStringConst) + 1];
-                strcpy(fcnResult.pStringConst, args[resultIndex].pStringConst);
+                fcnResult.pStringConst = new char[stringlen + 1];
+                memcpy(fcnResult.pStringConst, args[resultIndex].pStringConst, stringlen + 1);                                         // including terminating \0
             #if PRINT_HEAP_OBJ_CREA_DEL
                 _pDebugOut->print("\r\n+++++ (Intermd str) ");   _pDebugOut->println((uint32_t)fcnResult.pStringConst, HEX);
                 _pDebugOut->print("       switch, ifte ");   _pDebugOut->println(fcnResult.pStringConst);
@@ -1172,9 +1173,10 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
 
             // result is a non-empty string ? an object still has to be created on the heap
             if ((fcnResultValueType == value_isStringPointer) && (fcnResult.pStringConst != nullptr)) {
+                int stringlen = strlen(args[index].pStringConst);
                 _intermediateStringObjectCount++;
-                fcnResult.pStringConst = new char[strlen(args[index].pStringConst) + 1];
-                strcpy(fcnResult.pStringConst, args[index].pStringConst);
+                fcnResult.pStringConst = new char[stringlen + 1];
+                memcpy(fcnResult.pStringConst, args[index].pStringConst, stringlen + 1);                                               // including terminating \0
             #if PRINT_HEAP_OBJ_CREA_DEL
                 _pDebugOut->print("\r\n+++++ (Intermd str) ");   _pDebugOut->println((uint32_t)fcnResult.pStringConst, HEX);
                 _pDebugOut->print("             choose ");   _pDebugOut->println(fcnResult.pStringConst);
@@ -1252,6 +1254,183 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
         break;
 
 
+        // --------------------------------------------------------------------------------
+        // numeric array: sum, minimum, maximum, mean or standard deviation of all elements
+        // --------------------------------------------------------------------------------
+
+        // all array elements are processed in one loop, regardless of the array dimensions
+        // sum, minimum and maximum of a long array return a long (as with long integer addition, a sum is not tested for overflow)
+        // mean and standard deviation (population standard deviation) always return a float
+
+        case fnccod_arraySum:
+        case fnccod_arrayMin:
+        case fnccod_arrayMax:
+        case fnccod_arrayMean:
+        case fnccod_arrayStdDev:
+        {
+            if (argIsStringBits & (0x1 << 0)) { return result_arg_numberExpected; }                                         // value type of an array: value type of its elements
+            bool isLongArray = (argIsLongBits & (0x1 << 0));
+            void* pArray = *pFirstArgStackLvl->varOrConst.value.ppArray;
+            Val* pElements = (Val*)pArray + 1;                                                                              // array element 0 contains dimensions and dimension count
+            int arrayElements = arrayElementCount(pArray);
+
+            if (isLongArray && ((functionCode == fnccod_arraySum) || (functionCode == fnccod_arrayMin) || (functionCode == fnccod_arrayMax))) {
+                long result = pElements[0].longConst;
+                if (functionCode == fnccod_arraySum) { for (int i = 1; i < arrayElements; i++) { result += pElements[i].longConst; } }
+                else if (functionCode == fnccod_arrayMin) { for (int i = 1; i < arrayElements; i++) { if (pElements[i].longConst < result) { result = pElements[i].longConst; } } }
+                else { for (int i = 1; i < arrayElements; i++) { if (pElements[i].longConst > result) { result = pElements[i].longConst; } } }
+
+                fcnResultValueType = value_isLong;
+                fcnResult.longConst = result;
+                break;
+            }
+
+            fcnResultValueType = value_isFloat;
+            if (functionCode == fnccod_arrayMin) {
+                float result = pElements[0].floatConst;
+                for (int i = 1; i < arrayElements; i++) { if (pElements[i].floatConst < result) { result = pElements[i].floatConst; } }
+                fcnResult.floatConst = result;
+            }
+            else if (functionCode == fnccod_arrayMax) {
+                float result = pElements[0].floatConst;
+                for (int i = 1; i < arrayElements; i++) { if (pElements[i].floatConst > result) { result = pElements[i].floatConst; } }
+                fcnResult.floatConst = result;
+            }
+            else {
+                float sum{ 0. };
+                if (isLongArray) { for (int i = 0; i < arrayElements; i++) { sum += (float)pElements[i].longConst; } }
+                else { for (int i = 0; i < arrayElements; i++) { sum += pElements[i].floatConst; } }
+                fcnResult.floatConst = (functionCode == fnccod_arraySum) ? sum : sum / arrayElements;
+
+                if (functionCode == fnccod_arrayStdDev) {                                                                   // second pass: sum of squared deviations from the mean
+                    float mean = fcnResult.floatConst, sumOfSquares{ 0. };
+                    for (int i = 0; i < arrayElements; i++) {
+                        float deviation = (isLongArray ? (float)pElements[i].longConst : pElements[i].floatConst) - mean;
+                        sumOfSquares += deviation * deviation;
+                    }
+                    fcnResult.floatConst = sqrt(sumOfSquares / arrayElements);
+                }
+            }
+
+            if (isnan(fcnResult.floatConst)) { return result_undefined; }
+            if (!isfinite(fcnResult.floatConst)) { return result_overflow; }
+        }
+        break;
+
+
+        // -------------------------------------------------------------------------------------
+        // numeric array: set all elements to a value, or multiply by a factor and add an offset
+        // -------------------------------------------------------------------------------------
+
+        // the array must be a variable (not a constant). The value, factor and offset are converted to the value type of the array, as with an assignment
+        // for a long array, the element values are only calculated as floats if the factor or offset is a float
+        // scale: if an element value can not be calculated (overflow, undefined, float result outside the range of a long), an error is returned and the array is left unchanged
+        // returns the number of array elements
+
+        case fnccod_arrayFill:
+        case fnccod_arrayScale:
+        {
+            if (argIsConstantVarBits & (0x1 << 0)) { return result_arg_variableExpected; }
+            if (argIsStringBits & (0x1 << 0)) { return result_arg_numberExpected; }
+            for (int i = 1; i < suppliedArgCount; i++) { if (!(argIsLongBits & (0x1 << i)) && !(argIsFloatBits & (0x1 << i))) { return result_arg_numberExpected; } }
+
+            bool isLongArray = (argIsLongBits & (0x1 << 0));
+            void* pArray = *pFirstArgStackLvl->varOrConst.value.ppArray;
+            Val* pElements = (Val*)pArray + 1;
+            int arrayElements = arrayElementCount(pArray);
+
+            if (functionCode == fnccod_arrayFill) {
+                if (isLongArray) {
+                    long value = (argIsLongBits & (0x1 << 1)) ? args[1].longConst : (long)args[1].floatConst;
+                    for (int i = 0; i < arrayElements; i++) { pElements[i].longConst = value; }
+                }
+                else {
+                    float value = (argIsLongBits & (0x1 << 1)) ? (float)args[1].longConst : args[1].floatConst;
+                    for (int i = 0; i < arrayElements; i++) { pElements[i].floatConst = value; }
+                }
+            }
+
+            else {
+                bool argsAreLong = (argIsLongBits & (0x1 << 1)) && ((suppliedArgCount == 2) || (argIsLongBits & (0x1 << 2)));
+                if (isLongArray && argsAreLong) {
+                    long factor = args[1].longConst, offset = (suppliedArgCount == 3) ? args[2].longConst : 0;
+                    for (int i = 0; i < arrayElements; i++) { pElements[i].longConst = pElements[i].longConst * factor + offset; }
+                }
+                else {
+                    float factor = (argIsLongBits & (0x1 << 1)) ? (float)args[1].longConst : args[1].floatConst;
+                    float offset = (suppliedArgCount == 2) ? 0. : (argIsLongBits & (0x1 << 2)) ? (float)args[2].longConst : args[2].floatConst;
+
+                    // first pass: check all element values before changing any element
+                    const float longRangeLimit = (float)(1UL << (8 * sizeof(long) - 1));                                   // long range: -longRangeLimit up to longRangeLimit - 1
+                    for (int i = 0; i < arrayElements; i++) {
+                        float value = (isLongArray ? (float)pElements[i].longConst : pElements[i].floatConst) * factor + offset;
+                        if (isnan(value)) { return result_undefined; }
+                        if (!isfinite(value)) { return result_overflow; }
+                        if (isLongArray && ((value < -longRangeLimit) || (value >= longRangeLimit))) { return result_overflow; }     // outside the range of a long
+                    }
+
+                    if (isLongArray) { for (int i = 0; i < arrayElements; i++) { pElements[i].longConst = (long)((float)pElements[i].longConst * factor + offset); } }
+                    else { for (int i = 0; i < arrayElements; i++) { pElements[i].floatConst = pElements[i].floatConst * factor + offset; } }
+                }
+            }
+
+            fcnResultValueType = value_isLong;
+            fcnResult.longConst = arrayElements;
+        }
+        break;
+
+
+        // --------------------------------------------------------------------------------
+        // numeric arrays: copy all elements to another array, or dot product of two arrays
+        // --------------------------------------------------------------------------------
+
+        // both arrays must have the same number of elements (dimensions may differ). Elements are processed in storage order
+        // copy: first argument is the destination array (a variable, not a constant); values are converted to its value type. Returns the number of array elements 
+        // dot product: returns a long if both arrays are long arrays (as with long integer arithmetic, not tested for overflow), otherwise a float
+
+        case fnccod_arrayCopy:
+        case fnccod_arrayDot:
+        {
+            if ((functionCode == fnccod_arrayCopy) && (argIsConstantVarBits & (0x1 << 0))) { return result_arg_variableExpected; }
+            if ((argIsStringBits & (0x1 << 0)) || (argIsStringBits & (0x1 << 1))) { return result_arg_numberExpected; }
+            void* pArray1 = *pFirstArgStackLvl->varOrConst.value.ppArray;
+            void* pArray2 = *((LE_evalStack*)evalStack.getNextListElement(pFirstArgStackLvl))->varOrConst.value.ppArray;
+            int arrayElements = arrayElementCount(pArray1);
+            if (arrayElementCount(pArray2) != arrayElements) { return result_arg_invalid; }
+
+            bool isLongArray1 = (argIsLongBits & (0x1 << 0)), isLongArray2 = (argIsLongBits & (0x1 << 1));
+            Val* pElements1 = (Val*)pArray1 + 1, * pElements2 = (Val*)pArray2 + 1;
+
+            if (functionCode == fnccod_arrayCopy) {
+                if (isLongArray1 == isLongArray2) { memmove(pElements1, pElements2, arrayElements * sizeof(Val)); }        // same value type: copy memory (source can be the destination array)
+                else if (isLongArray1) { for (int i = 0; i < arrayElements; i++) { pElements1[i].longConst = (long)pElements2[i].floatConst; } }
+                else { for (int i = 0; i < arrayElements; i++) { pElements1[i].floatConst = (float)pElements2[i].longConst; } }
+
+                fcnResultValueType = value_isLong;
+                fcnResult.longConst = arrayElements;
+            }
+
+            else if (isLongArray1 && isLongArray2) {
+                long sum{ 0 };
+                for (int i = 0; i < arrayElements; i++) { sum += pElements1[i].longConst * pElements2[i].longConst; }
+                fcnResultValueType = value_isLong;
+                fcnResult.longConst = sum;
+            }
+
+            else {
+                float sum{ 0. };
+                for (int i = 0; i < arrayElements; i++) {
+                    sum += (isLongArray1 ? (float)pElements1[i].longConst : pElements1[i].floatConst) * (isLongArray2 ? (float)pElements2[i].longConst : pElements2[i].floatConst);
+                }
+                fcnResultValueType = value_isFloat;
+                fcnResult.floatConst = sum;
+                if (isnan(fcnResult.floatConst)) { return result_undefined; }
+                if (!isfinite(fcnResult.floatConst)) { return result_overflow; }
+            }
+        }
+        break;
+
+
         // -------------------
         // variable value type
         // -------------------
@@ -1886,15 +2065,16 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
 
             if (!(argIsStringBits & (0x1 << 0))) { return result_arg_stringExpected; }
 
-            int length = strlen(args[0].pStringConst);
             int charPos = 1;                                                                            // first character in string
             if (suppliedArgCount == 2) {
                 if (!(argIsLongBits & (0x1 << 1)) && !(argIsFloatBits & (0x1 << 1))) { return result_arg_numberExpected; }
                 charPos = (argIsLongBits & (0x1 << 1)) ? args[1].longConst : int(args[1].floatConst);
-                if (args[1].longConst < 1) { return result_arg_outsideRange; }
+                if (charPos < 1) { return result_arg_outsideRange; }
             }
 
-            if (strlen(args[0].pStringConst) < charPos + 1) { return result_arg_stringTooShort; }       // two characters needed, starting at given position
+            // two characters needed, starting at given position: no need to scan the string beyond these
+            int length = (args[0].pStringConst == nullptr) ? 0 : strnlen(args[0].pStringConst, charPos + 1);
+            if (length < charPos + 1) { return result_arg_stringTooShort; }
 
             const char asc_zero = 0x30, asc_a = 0x61, asc_A = 0x41;
             char*& hexDigitString = args[0].pStringConst;
@@ -1975,6 +2155,39 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
         break;
 
 
+        // return the contents or the length of a string buffer (contents: the returned string is a copy; buffer contents are not changed)
+        // ------------------------------------------------------------------------------------------------------------------------------
+
+        case fnccod_bufString:
+        case fnccod_bufLength:
+        {
+            if (!(argIsLongBits & (0x1 << 0)) && !(argIsFloatBits & (0x1 << 0))) { return result_arg_numberExpected; }
+            int bufferNumber = (argIsLongBits & (0x1 << 0)) ? args[0].longConst : int(args[0].floatConst);
+            if ((bufferNumber < 1) || (bufferNumber > MAX_STRING_BUFFERS)) { return result_arg_outsideRange; }
+            StringBuffer* pStringBuffer = _stringBuffers + bufferNumber - 1;
+
+            if (functionCode == fnccod_bufLength) {
+                fcnResultValueType = value_isLong;
+                fcnResult.longConst = pStringBuffer->length;
+                break;
+            }
+
+            // result is string (if stored in a variable, it will be clipped to the maximum string length)
+            fcnResultValueType = value_isStringPointer;
+            fcnResult.pStringConst = nullptr;                                                                               // init: empty buffer returns an empty string
+            if (pStringBuffer->length > 0) {
+                _intermediateStringObjectCount++;
+                fcnResult.pStringConst = new char[pStringBuffer->length + 1];
+                memcpy(fcnResult.pStringConst, pStringBuffer->pChars, pStringBuffer->length + 1);                          // including terminating '\0'
+            #if PRINT_HEAP_OBJ_CREA_DEL
+                _pDebugOut->print("\r\n+++++ (Intermd str) ");   _pDebugOut->println((uint32_t)fcnResult.pStringConst, HEX);
+                _pDebugOut->print("         bufString ");   _pDebugOut->println(fcnResult.pStringConst);
+            #endif
+            }
+        }
+        break;
+
+
         // return CR and LF character string
         // ---------------------------------
 
@@ -2012,8 +2225,10 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
             if (suppliedArgCount == 3) {
                 if (!(argIsLongBits & (0x1 << 2)) && !(argIsFloatBits & (0x1 << 2))) { return result_arg_numberExpected; }
                 charPos = (argIsLongBits & (0x1 << 2)) ? args[2].longConst : int(args[2].floatConst);
-                if ((args[2].longConst < 1) || (args[2].longConst > strlen(args[0].pStringConst))) { return result_arg_outsideRange; }
+                if (charPos < 1) { return result_arg_outsideRange; }
             }
+            // character position must be within the string: no need to scan the string beyond it
+            if ((args[0].pStringConst == nullptr) || ((int)strnlen(args[0].pStringConst, charPos) < charPos)) { return result_arg_outsideRange; }
 
             args[0].pStringConst[--charPos] = args[1].longConst;                                                            // ASCII code
 
@@ -2106,16 +2321,14 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
 
             char* startSearchAt = originalString;                                                                           // init: search for a match from start of string
 
-            // original string is not empty. replace only: findString can be empty 
-            int originalStrLen = strlen(originalString);                                                                    // not an empty string
-            int findStrLen = strlen(findString);                                                                            // not an empty string
-            int replaceStrLen = isReplace ? ((replaceString == nullptr) ? 0 : strlen(replaceString)) : 0;
-
+            // original string and string to find are not empty. replacement string can be empty
+            // string lengths are only determined where needed: a start position is checked with a scan up to that position only, and...
+            // ...find() doesn't need any string length (strstr() scans the string anyway) 
             if (suppliedArgCount == (isReplace ? 4 : 3)) {                                                                  // start position specified ? (base 1)
                 int startArgIndex = (isReplace ? 3 : 2);                                                                    // c++: base 0
                 if (!(argIsLongBits & (0x1 << startArgIndex)) && !(argIsFloatBits & (0x1 << startArgIndex))) { return result_arg_numberExpected; }
                 int startSearchPos = ((argIsLongBits & (0x1 << startArgIndex)) ? args[startArgIndex].longConst : (long)args[startArgIndex].floatConst) - 1;
-                if ((startSearchPos < 0) || (startSearchPos >= originalStrLen)) { return result_arg_outsideRange; }
+                if ((startSearchPos < 0) || ((int)strnlen(originalString, startSearchPos + 1) <= startSearchPos)) { return result_arg_outsideRange; }
                 startSearchAt += startSearchPos;                                                                            // first character in string to start search (base 0)
             }
 
@@ -2131,6 +2344,11 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
             // replace only (all positions base 0 except for values returned to Justina)
             // -------------------------------------------------------------------------
 
+            // string lengths: if a match was found, the original string is scanned only beyond the matching substring (front porch length is known)
+            int findStrLen = strlen(findString);                                                                            // not an empty string
+            int replaceStrLen = (replaceString == nullptr) ? 0 : strlen(replaceString);
+            int originalStrLen = (foundStartPos == -1) ? strlen(originalString) : foundStartPos + findStrLen + strlen(foundSubstringStart + findStrLen);
+
             // always create a new string (even if new string equals old string)
             _intermediateStringObjectCount++;
 
@@ -2139,7 +2357,7 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
             fcnResult.pStringConst = new char[newStringLen + 1];
 
             if (foundStartPos == -1) {
-                strcpy(fcnResult.pStringConst, originalString);                                                             // replace: return copy of original string
+                memcpy(fcnResult.pStringConst, originalString, originalStrLen + 1);                                         // replace: return copy of original string (including terminating \0)
             }
             else {
 
@@ -2209,7 +2427,7 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
             // create new string
             _intermediateStringObjectCount++;
             fcnResult.pStringConst = new char[len + 1];                                                                                 // same length as original, space for terminating 
-            strcpy(fcnResult.pStringConst, args[0].pStringConst);   // copy original string
+            memcpy(fcnResult.pStringConst, args[0].pStringConst, len + 1);                                                             // copy original string, including terminating \0
             for (int i = first; i <= last; i++) { fcnResult.pStringConst[i] = ((functionCode == fnccod_toupper) ? toupper(fcnResult.pStringConst[i]) : tolower(fcnResult.pStringConst[i])); }
         #if PRINT_HEAP_OBJ_CREA_DEL
             _pDebugOut->print("\r\n+++++ (Intermd str) ");   _pDebugOut->println((uint32_t)fcnResult.pStringConst, HEX);
@@ -2237,10 +2455,17 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
                 if (!(argIsLongBits & (0x1 << i)) && !(argIsFloatBits & (0x1 << i))) { return result_arg_numberExpected; }
                 if ((argIsFloatBits & (0x1 << i))) { args[i].longConst = int(args[i].floatConst); }                         // all these functions need integer values
             }
-            int len = strlen(args[0].pStringConst);
-
-            int first = (functionCode == fnccod_left) ? 0 : (functionCode == fnccod_mid) ? args[1].longConst - 1 : len - args[1].longConst;
-            int last = (functionCode == fnccod_left) ? args[1].longConst - 1 : (functionCode == fnccod_mid) ? first + args[2].longConst - 1 : len - 1;
+            // left, mid: the string only needs to be scanned up to the last character to return (not necessarily up to the end of the string)
+            int len{}, first{}, last{};
+            if (functionCode == fnccod_right) {
+                len = strlen(args[0].pStringConst);
+                first = len - args[1].longConst; last = len - 1;
+            }
+            else {
+                first = (functionCode == fnccod_left) ? 0 : args[1].longConst - 1;
+                last = (functionCode == fnccod_left) ? args[1].longConst - 1 : first + args[2].longConst - 1;
+                len = strnlen(args[0].pStringConst, (last < 0) ? 0 : last + 1);
+            }
 
             if ((first > last) || (first < 0) || (last >= len)) { return result_arg_outsideRange; }
 
@@ -2500,6 +2725,17 @@ Justina::execResult_type Justina::execInternalCppFunction(LE_evalStack*& pFuncti
                 }
                 break;
 
+                case 45: fcnResult.longConst = flowCtrlStack.getHighWaterMark(); break;         // flow control stack: highest element count reached
+                case 46: fcnResult.longConst = flowCtrlStack.getPoolMissCount(); break;         // flow control stack: elements not recycled from the size class pool (created on the heap)
+                case 47: fcnResult.longConst = parsedStatementLineStack.getHighWaterMark(); break;  // parsed statement line stack: highest element count reached
+                case 48: fcnResult.longConst = parsedStatementLineStack.getPoolMissCount(); break;  // parsed statement line stack: elements not recycled from the size class pool
+                case 49: fcnResult.longConst = _evalCacheHits; break;                           // eval() cache: eval() strings not parsed again (parsed statements reused)
+                case 50: fcnResult.longConst = _evalCacheMisses; break;                         // eval() cache: eval() strings parsed (not found in cache)
+                case 51: fcnResult.longConst = _batchLineCacheHits; break;                      // batch line cache: batch file lines not read and parsed again
+                case 52: fcnResult.longConst = _batchLineCacheMisses; break;                    // batch line cache: batch file lines read and parsed (not found in cache)
+                case 53: fcnResult.longConst = _maxStopLatency; break;                          // worst-case stop latency (ms): stop, abort or kill request relayed by housekeeping callback until honoured
+                case 54: fcnResult.longConst = _callsPerClockSample; break;                     // housekeeping calls between clock readings (currently)
+
                 default: return result_arg_invalid; break;
             }                                                                                   // switch (sysVal)
         }
@@ -59,6 +59,8 @@ LinkedList::LinkedList() {
 
 LinkedList::~LinkedList() {
     _listIDcounter--;                                                                               // static variable
+    if (_pSlotArea != nullptr) { delete[] _pSlotArea; }                                             // fixed capacity list: delete slot area
+    releasePool();                                                                                  // size class pool list: delete free blocks
 }
 
 
@@ -73,12 +75,110 @@ void LinkedList::setDebugOutStream(Print** ppDebugOutStream) {
 }
 
 
+// -----------------------------------------------------------------------------------------------------
+// *   fixed capacity list: preallocate one contiguous slot area, holding all future list elements   *
+// -----------------------------------------------------------------------------------------------------
+
+// list elements will not be created on the heap one by one, but will occupy a free slot instead. A slot is released again when its list element is deleted
+// the slot area is created once and is only deleted by the destructor. Call this method only while the list is still empty
+
+void LinkedList::setFixedCapacity(int slotCount, int maxPayloadSize) {
+    if ((_pSlotArea != nullptr) || (_pFirstElement != nullptr) || (slotCount <= 0)) { return; }    // slot area exists already, or list not empty: nothing to do
+
+    // slot size: list element header + maximum payload size, rounded up to a multiple of the pointer size (boundary alignment)
+    _slotSize = ((sizeof(ListElemHead) + maxPayloadSize + sizeof(void*) - 1) / sizeof(void*)) * sizeof(void*);
+    _slotCount = slotCount;
+    _pSlotArea = new char[_slotCount * _slotSize];
+
+    // chain all (free) slots
+    _pFreeSlot = nullptr;
+    for (int i = _slotCount - 1; i >= 0; i--) {
+        ListElemHead* pSlot = (ListElemHead*)(_pSlotArea + i * _slotSize);
+        pSlot->pNext = _pFreeSlot;
+        _pFreeSlot = pSlot;
+    }
+}
+
+
+// ------------------------------------------------------------------------
+// *   fixed capacity list: are all slots in use (no room to append) ?    *
+// ------------------------------------------------------------------------
+
+bool LinkedList::isFull() {
+    return ((_pSlotArea != nullptr) && (_pFreeSlot == nullptr));                                    // never full if list elements are created on the heap
+}
+
+
+// -------------------------------------------------------------------------------------------------
+// *   size class pool list: recycle deleted list elements instead of returning them to the heap   *
+// -------------------------------------------------------------------------------------------------
+
+// a list element is created with the payload size of the smallest size class that fits. When deleted, it's kept in the free list of its size class...
+// ...and handed out again by a next append with a payload size fitting in that size class (no heap allocation). Payloads larger than the largest size class...
+// ...are created and deleted on the heap as usual. Call this method only while the list is still empty (and not for a fixed capacity list)
+
+void LinkedList::setSizeClassPool(const int* pPayloadSizes, int sizeClassCount) {
+    if ((_pSlotArea != nullptr) || (_pFirstElement != nullptr) || (_sizeClassCount > 0)) { return; }  // fixed capacity list, list not empty or pool set already: nothing to do
+    if (sizeClassCount > maxSizeClasses) { sizeClassCount = maxSizeClasses; }
+
+    // store size classes in ascending order (insertion sort)
+    for (int i = 0; i < sizeClassCount; i++) {
+        int j = i;
+        while ((j > 0) && (_sizeClassPayloadSize[j - 1] > pPayloadSizes[i])) { _sizeClassPayloadSize[j] = _sizeClassPayloadSize[j - 1]; j--; }
+        _sizeClassPayloadSize[j] = pPayloadSizes[i];
+        _pFreeBlock[i] = nullptr;
+    }
+    _sizeClassCount = sizeClassCount;
+}
+
+
+// -----------------------------------------------------------------------------
+// *   size class pool list: return all free (recyclable) blocks to the heap   *
+// -----------------------------------------------------------------------------
+
+// list elements currently in use are not affected
+
+void LinkedList::releasePool() {
+    for (int i = 0; i < _sizeClassCount; i++) {
+        while (_pFreeBlock[i] != nullptr) {
+            ListElemHead* p = _pFreeBlock[i];
+            _pFreeBlock[i] = p->pNext;
+            delete[](char*)(((PoolBlockHead*)p) - 1);                                               // block starts with pool block header
+        }
+    }
+}
+
+
 // --------------------------------------------------
 // *   append a list element to the end of a list   *
 // --------------------------------------------------
 
+// fixed capacity list: if all slots are in use (or payload too large for a slot), nullptr is returned 
+
 char* LinkedList::appendListElement(int size) {
-    ListElemHead* p = (ListElemHead*)(new char[sizeof(ListElemHead) + size]);                       // create list object with payload of specified size in bytes
+    ListElemHead* p{};
+    if (_pSlotArea != nullptr) {                                                                    // fixed capacity list: take first free slot
+        if ((_pFreeSlot == nullptr) || ((int)sizeof(ListElemHead) + size > _slotSize)) { return nullptr; }
+        p = _pFreeSlot;
+        _pFreeSlot = _pFreeSlot->pNext;
+    }
+    else if (_sizeClassCount > 0) {                                                                 // size class pool list
+        int sizeClass{ 0 };
+        while ((sizeClass < _sizeClassCount) && (size > _sizeClassPayloadSize[sizeClass])) { sizeClass++; }    // smallest size class that fits
+        if (sizeClass == _sizeClassCount) { sizeClass = -1; }                                       // payload too large for any size class
+
+        if ((sizeClass >= 0) && (_pFreeBlock[sizeClass] != nullptr)) {                              // recycle free block
+            p = _pFreeBlock[sizeClass];
+            _pFreeBlock[sizeClass] = p->pNext;
+        }
+        else {                                                                                      // pool miss: create block on the heap
+            _poolMissCount++;
+            PoolBlockHead* pBlock = (PoolBlockHead*)(new char[sizeof(PoolBlockHead) + sizeof(ListElemHead) + ((sizeClass >= 0) ? _sizeClassPayloadSize[sizeClass] : size)]);
+            pBlock->sizeClass = sizeClass;
+            p = (ListElemHead*)(pBlock + 1);
+        }
+    }
+    else { p = (ListElemHead*)(new char[sizeof(ListElemHead) + size]); }                           // create list object with payload of specified size in bytes
 
     if (_pFirstElement == nullptr) {                                                                // not yet any elements
         _pFirstElement = p;
@@ -91,6 +191,7 @@ char* LinkedList::appendListElement(int size) {
     _pLastElement = p;
     p->pNext = nullptr;                                                                             // because p is now last element
     _listElementCount++;
+    if (_listElementCount > _highWaterMark) { _highWaterMark = _listElementCount; }
     _createdListObjectCounter++;
 
 #if PRINT_LLIST_OBJ_CREA_DEL
@@ -141,7 +242,13 @@ char* LinkedList::deleteListElement(void* pPayload) {
     ((pElem->pNext == nullptr) ? _pLastElement : pElem->pNext->pPrev) = pElem->pPrev;
 
     _listElementCount--;
-    delete[]pElem;
+    if (_pSlotArea != nullptr) { pElem->pNext = _pFreeSlot; _pFreeSlot = pElem; }                  // fixed capacity list: release slot (slot becomes first free slot)
+    else if (_sizeClassCount > 0) {                                                                 // size class pool list
+        PoolBlockHead* pBlock = ((PoolBlockHead*)pElem) - 1;
+        if (pBlock->sizeClass >= 0) { pElem->pNext = _pFreeBlock[pBlock->sizeClass]; _pFreeBlock[pBlock->sizeClass] = pElem; }     // keep for recycling
+        else { delete[](char*)pBlock; }                                                             // payload too large for any size class
+    }
+    else { delete[]pElem; }
 
     if (p == nullptr) { return nullptr; }
     // move pointer 1 list element header length: point to payload of next element in list (or nullptr if last element deleted)
@@ -246,6 +353,24 @@ int LinkedList::getElementCount() {
 }
 
 
+//-------------------------------------------------------------------
+// *   get highest list element count reached since list creation   *
+//-------------------------------------------------------------------
+
+long LinkedList::getHighWaterMark() {
+    return _highWaterMark;
+}
+
+
+//---------------------------------------------------------------------------------------------
+// *   size class pool list: get count of list elements that could not be recycled (misses)   *
+//---------------------------------------------------------------------------------------------
+
+long LinkedList::getPoolMissCount() {
+    return _poolMissCount;
+}
+
+
 //--------------------------------------------------
 // *   get count of created objects across lists   *
 //--------------------------------------------------
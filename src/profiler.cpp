@@ -0,0 +1,327 @@
+/***********************************************************************************************************
+*   Justina interpreter library                                                                            *
+*                                                                                                          *
+*   Copyright 2024, 2025 Herwig Taveirne                                                                   *
+*                                                                                                          *
+*   This file is part of the Justina Interpreter library.                                                  *
+*   The Justina interpreter library is free software: you can redistribute it and/or modify it under       *
+*   the terms of the GNU General Public License as published by the Free Software Foundation, either       *
+*   version 3 of the License, or (at your option) any later version.                                       *
+*                                                                                                          *
+*   This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;              *
+*   without even the implied warranty of  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.             *
+*   See the GNU General Public License for more details.                                                   *
+*                                                                                                          *
+*   You should have received a copy of the GNU General Public License along with this program. If not,     *
+*   see https://www.gnu.org/licenses.                                                                      *
+*                                                                                                          *
+*   The library is intended to work with 32 bit boards using the SAMD architecture ,                       *
+*   the Arduino nano RP2040 and Arduino nano ESP32 boards.                                                 *
+*                                                                                                          *
+*   See GitHub for more information and documentation: https://github.com/Herwig9820/Justina_interpreter   *
+*                                                                                                          *
+***********************************************************************************************************/
+
+
+#include "Justina.h"
+
+#define PRINT_DEBUG_INFO  0
+
+// *****************************************************
+// ***        class Justina - implementation         ***
+// *****************************************************
+
+/* ------------------------------------------------------------------------------------------------------------------------------------------
+    Profiler: statement counts and elapsed time (micros()) per Justina function and per parsed program statement.
+    - counters are kept in tables preallocated by the constructor: profiling does not create heap objects
+    - time elapsed since the previous profiler update is charged to the function and statement being executed, at each statement start,
+      Justina function call and return, and when execution ends (stop for debug, end of command line). Time spent in called functions
+      is charged to the called functions
+    - statements are recorded by their address in program memory (hash table). Source line numbers are only looked up when the report is
+      printed (counters of statements starting on the same source line are then added up)
+    - immediate mode statements, batch file lines and eval() strings are not profiled
+   ------------------------------------------------------------------------------------------------------------------------------------------ */
+
+
+// -------------------------------------------------------------------
+// *   clear all profiler counters (profiling is switched off too)   *
+// -------------------------------------------------------------------
+
+void Justina::clearProfile() {
+    if (_pProfileFunctions == nullptr) { return; }                                  // no profiler
+
+    for (int i = 0; i < MAX_JUSTINA_FUNCTIONS; i++) { _pProfileFunctions[i] = ProfileFunctionCounters{ 0, 0, 0 }; }
+    for (int i = 0; i < MAX_PROFILE_STATEMENTS; i++) { _pProfileStatements[i] = ProfileStatementCounters{ nullptr, 0, 0 }; }
+    _profileStatementsNotRecorded = 0;
+
+    _profilingOn = false;
+    _profileFunctionIndex = -1;
+    _profileStatementSlot = -1;
+}
+
+
+// ------------------------------------------------------------------------------------------------------
+// *   charge the time elapsed since the previous update to the function and statement being profiled   *
+// ------------------------------------------------------------------------------------------------------
+
+void Justina::profileCharge() {
+    unsigned long now = micros();
+    unsigned long elapsed = now - _profileLastTime;                                 // also correct if micros() overflowed
+    _profileLastTime = now;
+
+    if (_profileFunctionIndex >= 0) { _pProfileFunctions[_profileFunctionIndex].micros += elapsed; }
+    if (_profileStatementSlot >= 0) { _pProfileStatements[_profileStatementSlot].micros += elapsed; }
+}
+
+
+// ---------------------------------------------------
+// *   a statement starts: count it and profile it   *
+// ---------------------------------------------------
+
+void Justina::profileStatementStart(char* pStatement) {
+    profileCharge();
+
+    // statements in immediate mode memory (command line, batch file lines, eval() strings) are not profiled
+    if (pStatement >= _programStorage + _PROGRAM_MEMORY_SIZE) { _profileFunctionIndex = -1; _profileStatementSlot = -1; return; }
+
+    _profileFunctionIndex = _activeFunctionData.functionIndex;
+    _pProfileFunctions[_profileFunctionIndex].statements++;
+    _profileStatementSlot = profileStatementSlot(pStatement, true);                 // -1 if statement table is full
+    if (_profileStatementSlot >= 0) { _pProfileStatements[_profileStatementSlot].count++; }
+}
+
+
+// -------------------------------------------------------------------------------
+// *   a Justina function was launched: count the call and its first statement   *
+// -------------------------------------------------------------------------------
+
+void Justina::profileFunctionEntered(char* pFirstStatement) {
+    _pProfileFunctions[_activeFunctionData.functionIndex].calls++;
+    profileStatementStart(pFirstStatement);                                         // time until now is charged to the caller
+}
+
+
+// ----------------------------------------------------------------------------------------------------------------
+// *   a Justina function or eval() string returned: continue profiling the caller and the statement calling it   *
+// ----------------------------------------------------------------------------------------------------------------
+
+// the caller's statement is not counted again
+
+void Justina::profileReturnToCaller() {
+    profileCharge();
+
+    char* pStatement = _activeFunctionData.errorStatementStartStep;                 // statement start in caller
+    bool isProgramStatement = (pStatement < _programStorage + _PROGRAM_MEMORY_SIZE);
+    _profileFunctionIndex = isProgramStatement ? _activeFunctionData.functionIndex : -1;
+    _profileStatementSlot = isProgramStatement ? profileStatementSlot(pStatement, false) : -1;
+}
+
+
+// -----------------------------------------------------------------------------
+// *   execution ends (or profiling is switched off): stop charging any time   *
+// -----------------------------------------------------------------------------
+
+void Justina::profileStop() {
+    profileCharge();
+    _profileFunctionIndex = -1;
+    _profileStatementSlot = -1;
+}
+
+
+// --------------------------------------------------------------------------
+// *   find (and optionally add) the statement table entry of a statement   *
+// --------------------------------------------------------------------------
+
+// open addressing hash table, keyed by statement address. If a new statement doesn't fit, it is counted as 'not recorded'
+
+int Justina::profileStatementSlot(char* pStatement, bool addIfNew) {
+    constexpr int tableSize = (MAX_PROFILE_STATEMENTS > 0) ? MAX_PROFILE_STATEMENTS : 1;      // (without profiler, this routine is never called)
+    int slot = (uint32_t)(pStatement - _programStorage) % tableSize;
+    for (int probe = 0; probe < tableSize; probe++) {
+        if (_pProfileStatements[slot].pStatement == pStatement) { return slot; }
+        if (_pProfileStatements[slot].pStatement == nullptr) {                      // an empty entry ends the probe sequence
+            if (!addIfNew) { return -1; }
+            _pProfileStatements[slot].pStatement = pStatement;
+            return slot;
+        }
+        if (++slot == tableSize) { slot = 0; }
+    }
+
+    if (addIfNew) { _profileStatementsNotRecorded++; }                              // table full
+    return -1;
+}
+
+
+// -------------------------------------------
+// *   print profiler counters to a stream   *
+// -------------------------------------------
+
+// Justina functions and source lines are each sorted by time spent, in descending order
+// table format for console (or other external) streams, CSV format (one header line) for SD files
+
+void Justina::printProfile(bool asCSV) {
+
+    // Justina functions: sort function indexes (functions without calls are not listed)
+    // ---------------------------------------------------------------------------------
+
+    uint8_t functionOrder[MAX_JUSTINA_FUNCTIONS];
+    int functionsListed{ 0 };
+    for (int i = 0; i < _justinaFunctionCount; i++) {
+        if (_pProfileFunctions[i].calls == 0) { continue; }
+        int j = functionsListed++;
+        while ((j > 0) && (_pProfileFunctions[functionOrder[j - 1]].micros < _pProfileFunctions[i].micros)) { functionOrder[j] = functionOrder[j - 1]; j--; }
+        functionOrder[j] = i;
+    }
+
+
+    // source lines: add up counters of statements starting on the same source line, then sort
+    // ----------------------------------------------------------------------------------------
+
+    struct ProfileLine {
+        long sourceLine;
+        int functionIndex;                                                          // function containing the source line
+        long count;
+        unsigned long micros;
+    };
+
+    ProfileLine* pLines = new ProfileLine[MAX_PROFILE_STATEMENTS];                 // temporary
+    int linesListed{ 0 };
+    for (int slot = 0; slot < MAX_PROFILE_STATEMENTS; slot++) {
+        char* pStatement = _pProfileStatements[slot].pStatement;
+        if ((pStatement == nullptr) || (pStatement == _programStorage)) { continue; }   // first program statement ('program' command) is never executed
+
+        long sourceLine = _pBreakpoints->findLineNumberForBPstatement(pStatement);
+        int line = 0;
+        while ((line < linesListed) && (pLines[line].sourceLine != sourceLine)) { line++; }
+        if (line == linesListed) {
+            // function containing the statement: the function starting last, before the statement
+            int functionIndex{ -1 };
+            for (int i = 0; i < _justinaFunctionCount; i++) {
+                char* pStart = justinaFunctionData[i].pJustinaFunctionStartToken;
+                if ((pStart < pStatement) && ((functionIndex == -1) || (pStart > justinaFunctionData[functionIndex].pJustinaFunctionStartToken))) { functionIndex = i; }
+            }
+            pLines[linesListed++] = ProfileLine{ sourceLine, functionIndex, 0, 0 };
+        }
+        pLines[line].count += _pProfileStatements[slot].count;
+        pLines[line].micros += _pProfileStatements[slot].micros;
+    }
+
+    for (int i = 1; i < linesListed; i++) {                                         // insertion sort
+        ProfileLine temp = pLines[i];
+        int j = i;
+        while ((j > 0) && (pLines[j - 1].micros < temp.micros)) { pLines[j] = pLines[j - 1]; j--; }
+        pLines[j] = temp;
+    }
+
+
+    // print
+    // -----
+
+    char line[80];                                                                  // sufficient length for all line elements in sprintf (names are printed separately)
+    if (asCSV) {
+        println("type,function,line,calls,count,micros");
+        for (int i = 0; i < functionsListed; i++) {
+            ProfileFunctionCounters& counters = _pProfileFunctions[functionOrder[i]];
+            print("function,"); print(JustinaFunctionNames[functionOrder[i]]);
+            sprintf(line, ",,%ld,%ld,%lu", counters.calls, counters.statements, counters.micros);
+            println(line);
+        }
+        for (int i = 0; i < linesListed; i++) {
+            print("line,");  print(pLines[i].functionIndex >= 0 ? JustinaFunctionNames[pLines[i].functionIndex] : "");
+            sprintf(line, ",%ld,,%ld,%lu", pLines[i].sourceLine, pLines[i].count, pLines[i].micros);
+            println(line);
+        }
+    }
+
+    else {
+        print("Profiling is currently "); println(_profilingOn ? "ON\r\n" : "OFF\r\n");
+
+        println("     calls   statements       micros   function\r\n----------   ----------   ----------   --------");
+        for (int i = 0; i < functionsListed; i++) {
+            ProfileFunctionCounters& counters = _pProfileFunctions[functionOrder[i]];
+            sprintf(line, "%10ld   %10ld   %10lu   ", counters.calls, counters.statements, counters.micros);
+            print(line); println(JustinaFunctionNames[functionOrder[i]]);
+        }
+        if (functionsListed == 0) { println("(none)"); }
+
+        println("\r\nsource   statements       micros   function\r\n  line\r\n------   ----------   ----------   --------");
+        for (int i = 0; i < linesListed; i++) {
+            sprintf(line, "%6ld   %10ld   %10lu   ", pLines[i].sourceLine, pLines[i].count, pLines[i].micros);
+            print(line); println(pLines[i].functionIndex >= 0 ? JustinaFunctionNames[pLines[i].functionIndex] : "");
+        }
+        if (linesListed == 0) { println("(none)"); }
+
+        if (_profileStatementsNotRecorded > 0) {
+            sprintf(line, "\r\n(statements table full: %ld statements not recorded)", _profileStatementsNotRecorded);
+            println(line);
+        }
+    }
+
+    delete[] pLines;
+}
+
+
+/* ------------------------------------------------------------------------------------------------------------------------------------------
+    Tracer: begin and end events (Justina function calls, eval() strings, batch files, SD files, housekeeping callbacks) are recorded with
+    a micros() timestamp in a ring buffer preallocated by the constructor. When the buffer is full, the oldest events are overwritten.
+    The buffer is printed in Chrome trace event JSON format (to be viewed in a trace viewer, like chrome://tracing or Perfetto):
+    - functions, eval() strings, batch files and callbacks are duration events ('B' and 'E'), SD files are async events ('b' and 'e')
+    - functions terminated by an execution error (or abort) receive their end event when the call stack is cleared
+   ------------------------------------------------------------------------------------------------------------------------------------------ */
+
+
+// ------------------------------------------------------------
+// *   clear the trace buffer (tracing is switched off too)   *
+// ------------------------------------------------------------
+
+void Justina::clearTrace() {
+    _tracingOn = false;
+    _traceNextEvent = 0;
+    _traceEventCount = 0;
+}
+
+
+// -----------------------------------------------
+// *   record a trace event in the ring buffer   *
+// -----------------------------------------------
+
+void Justina::traceEvent(char eventType, char phase, int id) {
+    _pTraceEvents[_traceNextEvent] = TraceEvent{ micros(), eventType, phase, (uint16_t)id };
+    if (++_traceNextEvent == MAX_TRACE_EVENTS) { _traceNextEvent = 0; }            // overwrite oldest events next
+    if (_traceEventCount < MAX_TRACE_EVENTS) { _traceEventCount++; }
+}
+
+
+// ---------------------------------------------------------------
+// *   print the trace buffer (Chrome trace event JSON format)   *
+// ---------------------------------------------------------------
+
+void Justina::printTrace() {
+    static const char* const eventNames[]{ "", "eval()", "batch file ", "SD file ", "housekeeping callback" };     // indexed by trace event type
+    static const char* const eventCategories[]{ "function", "eval", "batch", "SD", "callback" };
+
+    char line[80];                                                                  // sufficient length for all line elements in sprintf
+
+    println("{\"traceEvents\":[");
+    int event = _traceNextEvent - _traceEventCount;                                 // oldest event
+    if (event < 0) { event += MAX_TRACE_EVENTS; }
+
+    for (int i = 0; i < _traceEventCount; i++) {
+        TraceEvent& entry = _pTraceEvents[event];
+        bool isFileEvent = (entry.eventType == trace_SDfile);                 // SD files do not nest: async events
+        bool withId = (entry.eventType == trace_batchFile) || isFileEvent;
+
+        print("{\"name\":\"");
+        if (entry.eventType == trace_function) { print((entry.id < _justinaFunctionCount) ? JustinaFunctionNames[entry.id] : "?"); }
+        else { print(eventNames[(uint8_t)entry.eventType]); if (withId) { print(entry.id); } }
+
+        sprintf(line, "\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%lu,\"pid\":1,\"tid\":1", eventCategories[(uint8_t)entry.eventType],
+            isFileEvent ? tolower(entry.phase) : entry.phase, entry.time);
+        print(line);
+        if (isFileEvent) { sprintf(line, ",\"id\":%u", entry.id); print(line); }
+        println((i < _traceEventCount - 1) ? "}," : "}");
+
+        if (++event == MAX_TRACE_EVENTS) { event = 0; }
+    }
+    println("]}");
+}